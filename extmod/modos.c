@@ -156,6 +156,8 @@ STATIC const mp_rom_map_elem_t os_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_stat), MP_ROM_PTR(&mp_vfs_stat_obj) },
     { MP_ROM_QSTR(MP_QSTR_statvfs), MP_ROM_PTR(&mp_vfs_statvfs_obj) },
     { MP_ROM_QSTR(MP_QSTR_unlink), MP_ROM_PTR(&mp_vfs_remove_obj) }, // unlink aliases to remove
+    // CIRCUITPY-CHANGE
+    { MP_ROM_QSTR(MP_QSTR_walk), MP_ROM_PTR(&mp_vfs_walk_obj) },
     #endif
 
     // The following are MicroPython extensions.
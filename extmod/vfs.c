@@ -296,9 +296,10 @@ mp_obj_t mp_vfs_umount(mp_obj_t mnt_in) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_umount_obj, mp_vfs_umount);
 
-// Note: buffering and encoding args are currently ignored
+// CIRCUITPY-CHANGE: encoding is currently ignored. buffering is passed on to
+// VfsFat, which uses it for log files; other filesystems ignore it.
 mp_obj_t mp_vfs_open(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_file, ARG_mode, ARG_encoding };
+    enum { ARG_file, ARG_mode, ARG_buffering, ARG_encoding };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_file, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_rom_obj = MP_ROM_NONE} },
         { MP_QSTR_mode, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_r)} },
@@ -318,6 +319,13 @@ mp_obj_t mp_vfs_open(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args)
     #endif
 
     mp_vfs_mount_t *vfs = lookup_path(args[ARG_file].u_obj, &args[ARG_file].u_obj);
+    #if MICROPY_VFS_FAT && MICROPY_VFS_FAT_LOG
+    // CIRCUITPY-CHANGE: FAT volumes buffer files opened for appending as logs.
+    if (args[ARG_buffering].u_int > 1 && vfs != MP_VFS_NONE && vfs != MP_VFS_ROOT && mp_obj_is_type(vfs->obj, &mp_fat_vfs_type)) {
+        mp_obj_t open_args[4] = { vfs->obj, args[ARG_file].u_obj, args[ARG_mode].u_obj, MP_OBJ_NEW_SMALL_INT(args[ARG_buffering].u_int) };
+        return mp_call_function_n_kw(MP_OBJ_FROM_PTR(&fat_vfs_open_obj), 4, 0, open_args);
+    }
+    #endif
     return mp_vfs_proxy_call(vfs, MP_QSTR_open, 2, (mp_obj_t *)&args);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(mp_vfs_open_obj, 0, mp_vfs_open);
@@ -433,6 +441,116 @@ mp_obj_t mp_vfs_listdir(size_t n_args, const mp_obj_t *args) {
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_vfs_listdir_obj, 0, 1, mp_vfs_listdir);
 
+// CIRCUITPY-CHANGE: os.walk(), sorting entries by the type that ilistdir()
+// already has from the directory record instead of stat()ing each one.
+typedef struct _mp_vfs_walk_it_t {
+    mp_obj_base_t base;
+    mp_fun_1_t iternext;
+    // Directories still to be listed; the last one is listed next.
+    mp_obj_t pending;
+    // The directory yielded last and its dirnames list, which the caller
+    // may have changed to choose the subdirectories that are walked.
+    mp_obj_t dirpath;
+    mp_obj_t dirnames;
+} mp_vfs_walk_it_t;
+
+STATIC mp_obj_t mp_vfs_walk_join(mp_obj_t dir_in, mp_obj_t name_in) {
+    size_t dir_len, name_len;
+    const char *dir = mp_obj_str_get_data(dir_in, &dir_len);
+    const char *name = mp_obj_str_get_data(name_in, &name_len);
+    vstr_t vstr;
+    vstr_init(&vstr, dir_len + 1 + name_len);
+    vstr_add_strn(&vstr, dir, dir_len);
+    if (dir_len > 0 && dir[dir_len - 1] != '/') {
+        vstr_add_byte(&vstr, '/');
+    }
+    vstr_add_strn(&vstr, name, name_len);
+    if (mp_obj_is_type(dir_in, &mp_type_bytes)) {
+        return mp_obj_new_bytes_from_vstr(&vstr);
+    }
+    return mp_obj_new_str_from_vstr(&vstr);
+}
+
+STATIC mp_obj_t mp_vfs_walk_it_iternext(mp_obj_t self_in) {
+    mp_vfs_walk_it_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->dirnames != MP_OBJ_NULL) {
+        // Push the subdirectories in reverse so the first is walked first.
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_list_get(self->dirnames, &len, &items);
+        while (len > 0) {
+            mp_obj_list_append(self->pending, mp_vfs_walk_join(self->dirpath, items[--len]));
+        }
+        self->dirpath = MP_OBJ_NULL;
+        self->dirnames = MP_OBJ_NULL;
+    }
+
+    for (;;) {
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_list_get(self->pending, &len, &items);
+        if (len == 0) {
+            return MP_OBJ_STOP_ITERATION;
+        }
+        mp_obj_t dirpath = items[len - 1];
+        mp_obj_list_set_len(self->pending, len - 1);
+
+        // Only top can end in a slash, which not every filesystem accepts.
+        size_t path_len;
+        const char *path = mp_obj_str_get_data(dirpath, &path_len);
+        mp_obj_t list_path = dirpath;
+        if (path_len > 1 && path[path_len - 1] == '/') {
+            while (path_len > 1 && path[path_len - 1] == '/') {
+                path_len--;
+            }
+            list_path = mp_obj_new_str_of_type(mp_obj_get_type(dirpath), (const byte *)path, path_len);
+        }
+
+        mp_obj_t iter;
+        nlr_buf_t nlr;
+        if (nlr_push(&nlr) == 0) {
+            iter = mp_vfs_ilistdir(1, &list_path);
+            nlr_pop();
+        } else {
+            // Like CPython, skip directories that can't be listed.
+            if (mp_obj_is_subclass_fast(MP_OBJ_FROM_PTR(((mp_obj_base_t *)nlr.ret_val)->type), MP_OBJ_FROM_PTR(&mp_type_OSError))) {
+                continue;
+            }
+            nlr_jump(nlr.ret_val);
+        }
+
+        mp_obj_t dirnames = mp_obj_new_list(0, NULL);
+        mp_obj_t filenames = mp_obj_new_list(0, NULL);
+        mp_obj_t next;
+        while ((next = mp_iternext(iter)) != MP_OBJ_STOP_ITERATION) {
+            size_t n;
+            mp_obj_t *entry;
+            mp_obj_get_array(next, &n, &entry);
+            // Entries of unknown type (such as symbolic links) count as files.
+            bool is_dir = n > 1 && mp_obj_get_int(entry[1]) == MP_S_IFDIR;
+            mp_obj_list_append(is_dir ? dirnames : filenames, entry[0]);
+            #ifdef RUN_BACKGROUND_TASKS
+            RUN_BACKGROUND_TASKS;
+            #endif
+        }
+
+        self->dirpath = dirpath;
+        self->dirnames = dirnames;
+        mp_obj_t tuple[3] = { dirpath, dirnames, filenames };
+        return mp_obj_new_tuple(3, tuple);
+    }
+}
+
+mp_obj_t mp_vfs_walk(mp_obj_t top_in) {
+    mp_vfs_walk_it_t *iter = mp_obj_malloc(mp_vfs_walk_it_t, &mp_type_polymorph_iter);
+    iter->iternext = mp_vfs_walk_it_iternext;
+    iter->pending = mp_obj_new_list(1, &top_in);
+    iter->dirpath = MP_OBJ_NULL;
+    iter->dirnames = MP_OBJ_NULL;
+    return MP_OBJ_FROM_PTR(iter);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_walk_obj, mp_vfs_walk);
+
 mp_obj_t mp_vfs_mkdir(mp_obj_t path_in) {
     mp_obj_t path_out = mp_const_none;
     mp_vfs_mount_t *vfs = lookup_path(path_in, &path_out);
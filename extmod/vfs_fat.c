@@ -42,6 +42,7 @@
 #include "py/runtime.h"
 #include "py/mperrno.h"
 #include "lib/oofatfs/ff.h"
+#include "lib/oofatfs/diskio.h"
 #include "extmod/vfs_fat.h"
 #include "shared/timeutils/timeutils.h"
 #include "supervisor/filesystem.h"
@@ -86,6 +87,15 @@ STATIC mp_obj_t fat_vfs_make_new(const mp_obj_type_t *type, size_t n_args, size_
     vfs->blockdev.block_size = FF_MIN_SS; // default, will be populated by call to MP_BLOCKDEV_IOCTL_BLOCK_SIZE
     mp_vfs_blockdev_init(&vfs->blockdev, args[0]);
 
+    #if MICROPY_FATFS_CACHE_SECTORS
+    // The filesystem still works without a cache, so don't fail if there's no room for one.
+    vfs->cache = m_new_obj_var_maybe(vfs_fat_cache_t, uint8_t, MICROPY_FATFS_CACHE_SECTORS * FF_MAX_SS);
+    if (vfs->cache != NULL) {
+        memset(vfs->cache, 0, sizeof(vfs_fat_cache_t));
+        vfs->cache->next_sector = UINT32_MAX;
+    }
+    #endif
+
     // mount the block device so the VFS methods can be used
     FRESULT res = f_mount(&vfs->fatfs);
     if (res == FR_NO_FILESYSTEM) {
@@ -426,12 +436,38 @@ STATIC mp_obj_t vfs_fat_mount(mp_obj_t self_in, mp_obj_t readonly, mp_obj_t mkfs
 STATIC MP_DEFINE_CONST_FUN_OBJ_3(vfs_fat_mount_obj, vfs_fat_mount);
 
 STATIC mp_obj_t vfs_fat_umount(mp_obj_t self_in) {
+    #if MICROPY_FATFS_CACHE_SECTORS
+    // write back anything still cached, since the device may be removed next
+    fs_user_mount_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->cache != NULL && disk_ioctl(self, CTRL_SYNC, NULL) != RES_OK) {
+        mp_raise_OSError(MP_EIO);
+    }
+    #else
     (void)self_in;
+    #endif
     // keep the FAT filesystem mounted internally so the VFS methods can still be used
     return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(fat_vfs_umount_obj, vfs_fat_umount);
 
+#if MICROPY_FATFS_CACHE_SECTORS
+STATIC mp_obj_t vfs_fat_cache_stats(mp_obj_t self_in) {
+    fs_user_mount_t *self = MP_OBJ_TO_PTR(self_in);
+    vfs_fat_cache_t *cache = self->cache;
+    if (cache == NULL) {
+        return mp_const_none;
+    }
+    mp_obj_t tuple[4] = {
+        mp_obj_new_int_from_uint(cache->hits),
+        mp_obj_new_int_from_uint(cache->misses),
+        mp_obj_new_int_from_uint(cache->blocks_read),
+        mp_obj_new_int_from_uint(cache->blocks_written),
+    };
+    return mp_obj_new_tuple(4, tuple);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(fat_vfs_cache_stats_obj, vfs_fat_cache_stats);
+#endif
+
 STATIC mp_obj_t vfs_fat_utime(mp_obj_t vfs_in, mp_obj_t path_in, mp_obj_t times_in) {
     mp_obj_fat_vfs_t *self = MP_OBJ_TO_PTR(vfs_in);
     const char *path = mp_obj_str_get_str(path_in);
@@ -524,6 +560,9 @@ STATIC const mp_rom_map_elem_t fat_vfs_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_statvfs), MP_ROM_PTR(&fat_vfs_statvfs_obj) },
     { MP_ROM_QSTR(MP_QSTR_mount), MP_ROM_PTR(&vfs_fat_mount_obj) },
     { MP_ROM_QSTR(MP_QSTR_umount), MP_ROM_PTR(&fat_vfs_umount_obj) },
+    #if MICROPY_FATFS_CACHE_SECTORS
+    { MP_ROM_QSTR(MP_QSTR_cache_stats), MP_ROM_PTR(&fat_vfs_cache_stats_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_utime), MP_ROM_PTR(&fat_vfs_utime_obj) },
     { MP_ROM_QSTR(MP_QSTR_readonly), MP_ROM_PTR(&fat_vfs_readonly_obj) },
     #if MICROPY_FATFS_USE_LABEL
@@ -30,22 +30,101 @@
 #include "lib/oofatfs/ff.h"
 #include "extmod/vfs.h"
 
+// Number of sectors cached between FatFs and the block device of each VfsFat.
+// FatFs is built with FF_FS_TINY, so all open files share one sector window;
+// the cache keeps sectors from being re-read when several files are in use,
+// holds writes until the filesystem is synced and reads ahead sequentially.
+#ifndef MICROPY_FATFS_CACHE_SECTORS
+#define MICROPY_FATFS_CACHE_SECTORS (0)
+#endif
+
+// Sectors read at once when single-sector reads are sequential.
+#ifndef MICROPY_FATFS_CACHE_READAHEAD
+#define MICROPY_FATFS_CACHE_READAHEAD (MICROPY_FATFS_CACHE_SECTORS / 2)
+#endif
+
+// Files opened with open(path, "a", buffering=n) keep each write() as a record
+// in a RAM buffer of n bytes and commit whole records to the volume when the
+// buffer is full, on flush() and close(), and at the latest this many
+// milliseconds after the oldest record was written.
+#ifndef MICROPY_VFS_FAT_LOG
+#define MICROPY_VFS_FAT_LOG (0)
+#endif
+
+#ifndef MICROPY_VFS_FAT_LOG_COMMIT_MS
+#define MICROPY_VFS_FAT_LOG_COMMIT_MS (1000)
+#endif
+
+#if MICROPY_FATFS_CACHE_SECTORS
+typedef struct _vfs_fat_cache_t {
+    uint32_t clock;
+    // The sector after the last one read, to detect sequential reads.
+    DWORD next_sector;
+    // Size of the block device, read when first needed.
+    DWORD block_count;
+    // Sectors requested by FatFs that were or were not in the cache, and
+    // sectors actually transferred to and from the block device.
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t blocks_read;
+    uint32_t blocks_written;
+    struct {
+        DWORD sector;
+        uint32_t used;
+        bool valid;
+        bool dirty;
+    } slot[MICROPY_FATFS_CACHE_SECTORS];
+    // MICROPY_FATFS_CACHE_SECTORS sectors of blockdev.block_size bytes.
+    uint8_t data[];
+} vfs_fat_cache_t;
+#endif
+
 typedef struct _fs_user_mount_t {
     mp_obj_base_t base;
     mp_vfs_blockdev_t blockdev;
     FATFS fatfs;
+    #if MICROPY_FATFS_CACHE_SECTORS
+    // NULL if the mount is not cached.
+    vfs_fat_cache_t *cache;
+    #endif
 } fs_user_mount_t;
 
 extern const byte fresult_to_errno_table[20];
+// Incremented on every write to any FAT block device, so that anything cached
+// from file contents can tell when it may be stale.
+extern uint32_t vfs_fat_write_count;
+// Number of block device operations in progress. Background tasks can run while
+// a block device waits, and must not call FatFs then.
+extern uint32_t vfs_fat_disk_busy;
 extern const mp_obj_type_t mp_fat_vfs_type;
 extern const mp_obj_type_t mp_type_vfs_fat_fileio;
 extern const mp_obj_type_t mp_type_vfs_fat_textio;
 
-MP_DECLARE_CONST_FUN_OBJ_3(fat_vfs_open_obj);
+MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(fat_vfs_open_obj);
 
 typedef struct _pyb_file_obj_t {
     mp_obj_base_t base;
     FIL fp;
 } pyb_file_obj_t;
 
+#if MICROPY_VFS_FAT_LOG
+typedef struct _vfs_fat_log_obj_t {
+    pyb_file_obj_t file;
+    // Log files with records waiting for their timed commit.
+    struct _vfs_fat_log_obj_t *next;
+    uint8_t *buf;
+    size_t size;
+    size_t len;
+    // mp_hal_ticks_ms() when the oldest record in buf was written.
+    mp_uint_t first_ms;
+    bool pending;
+} vfs_fat_log_obj_t;
+
+extern const mp_obj_type_t mp_type_vfs_fat_log_fileio;
+extern const mp_obj_type_t mp_type_vfs_fat_log_textio;
+
+// Commit the records of log files that have waited MICROPY_VFS_FAT_LOG_COMMIT_MS.
+void vfs_fat_log_background(void);
+#endif
+
 #endif  // MICROPY_INCLUDED_EXTMOD_VFS_FAT_H
@@ -32,6 +32,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "py/mphal.h"
 
@@ -44,6 +45,205 @@
 #include "extmod/vfs_fat.h"
 
 typedef void *bdev_t;
+
+uint32_t vfs_fat_write_count;
+uint32_t vfs_fat_disk_busy;
+
+#if MICROPY_FATFS_CACHE_SECTORS
+
+#define CACHE_SLOTS (MICROPY_FATFS_CACHE_SECTORS)
+
+STATIC uint8_t *cache_data(fs_user_mount_t *vfs, size_t i) {
+    return vfs->cache->data + i * vfs->blockdev.block_size;
+}
+
+STATIC int cache_find(vfs_fat_cache_t *cache, DWORD sector) {
+    for (size_t i = 0; i < CACHE_SLOTS; i++) {
+        if (cache->slot[i].valid && cache->slot[i].sector == sector) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+STATIC void cache_touch(vfs_fat_cache_t *cache, size_t i) {
+    cache->slot[i].used = ++cache->clock;
+}
+
+// Write the dirty slots in [start, end) to the device. Consecutive sectors in
+// consecutive slots go out in a single write.
+STATIC int cache_write_back(fs_user_mount_t *vfs, size_t start, size_t end) {
+    vfs_fat_cache_t *cache = vfs->cache;
+    size_t i = start;
+    while (i < end) {
+        if (!cache->slot[i].dirty) {
+            i++;
+            continue;
+        }
+        size_t n = 1;
+        while (i + n < end && cache->slot[i + n].dirty &&
+               cache->slot[i + n].sector == cache->slot[i].sector + n) {
+            n++;
+        }
+        int ret = mp_vfs_blockdev_write(&vfs->blockdev, cache->slot[i].sector, n, cache_data(vfs, i));
+        if (ret != 0) {
+            return ret;
+        }
+        cache->blocks_written += n;
+        for (size_t j = i; j < i + n; j++) {
+            cache->slot[j].dirty = false;
+        }
+        i += n;
+    }
+    return 0;
+}
+
+// Free n consecutive slots to hold sectors starting at the given one, and
+// return the index of the first, or -1 if a dirty slot could not be written.
+STATIC int cache_claim(fs_user_mount_t *vfs, DWORD sector, size_t n) {
+    vfs_fat_cache_t *cache = vfs->cache;
+    size_t start = 0;
+    // A sector written straight after the previous one goes in the next slot,
+    // so the two can be written back together.
+    int prev = n == 1 ? cache_find(cache, sector - 1) : -1;
+    if (prev >= 0 && prev + 1 < CACHE_SLOTS && !cache->slot[prev + 1].dirty) {
+        start = prev + 1;
+    } else {
+        // Otherwise take the run of slots whose newest sector is oldest.
+        uint32_t best = UINT32_MAX;
+        for (size_t s = 0; s + n <= CACHE_SLOTS; s++) {
+            uint32_t newest = 0;
+            for (size_t j = s; j < s + n; j++) {
+                if (cache->slot[j].valid) {
+                    newest = MAX(newest, cache->slot[j].used);
+                }
+            }
+            if (newest < best) {
+                best = newest;
+                start = s;
+            }
+        }
+    }
+    for (size_t j = start; j < start + n; j++) {
+        if (cache->slot[j].dirty) {
+            // Evicting a dirty sector is a good time to write back the rest.
+            if (cache_write_back(vfs, 0, CACHE_SLOTS) != 0) {
+                return -1;
+            }
+            break;
+        }
+    }
+    for (size_t j = start; j < start + n; j++) {
+        cache->slot[j].valid = false;
+    }
+    return start;
+}
+
+STATIC DRESULT cache_read(fs_user_mount_t *vfs, BYTE *buff, DWORD sector, UINT count) {
+    vfs_fat_cache_t *cache = vfs->cache;
+    size_t block_size = vfs->blockdev.block_size;
+    bool sequential = sector == cache->next_sector;
+    cache->next_sector = sector + count;
+
+    if (count > 1) {
+        // Multi-sector reads are whole clusters of file data that FatFs will
+        // not ask for again, so they bypass the cache. Cached sectors may be
+        // newer than the device, though.
+        UINT cached = 0;
+        for (size_t i = 0; i < CACHE_SLOTS; i++) {
+            if (cache->slot[i].valid && cache->slot[i].sector - sector < count) {
+                cached++;
+            }
+        }
+        if (cached < count) {
+            if (mp_vfs_blockdev_read(&vfs->blockdev, sector, count, buff) != 0) {
+                return RES_ERROR;
+            }
+            cache->blocks_read += count;
+        }
+        for (size_t i = 0; i < CACHE_SLOTS; i++) {
+            if (cache->slot[i].valid && cache->slot[i].sector - sector < count) {
+                memcpy(buff + (cache->slot[i].sector - sector) * block_size, cache_data(vfs, i), block_size);
+                cache_touch(cache, i);
+            }
+        }
+        cache->hits += cached;
+        cache->misses += count - cached;
+        return RES_OK;
+    }
+
+    int i = cache_find(cache, sector);
+    if (i >= 0) {
+        cache->hits++;
+    } else {
+        cache->misses++;
+        size_t n = 1;
+        if (sequential && MICROPY_FATFS_CACHE_READAHEAD > 1) {
+            if (cache->block_count == 0) {
+                cache->block_count = mp_obj_get_int(mp_vfs_blockdev_ioctl(&vfs->blockdev, MP_BLOCKDEV_IOCTL_BLOCK_COUNT, 0));
+            }
+            if (sector < cache->block_count) {
+                n = MIN(MICROPY_FATFS_CACHE_READAHEAD, cache->block_count - sector);
+            }
+        }
+        i = cache_claim(vfs, sector, n);
+        if (i < 0 || mp_vfs_blockdev_read(&vfs->blockdev, sector, n, cache_data(vfs, i)) != 0) {
+            return RES_ERROR;
+        }
+        cache->blocks_read += n;
+        for (size_t j = 0; j < n; j++) {
+            // Keep the copy already in the cache if there is one, since it
+            // may hold writes the device hasn't seen yet.
+            if (j > 0 && cache_find(cache, sector + j) >= 0) {
+                continue;
+            }
+            cache->slot[i + j].sector = sector + j;
+            cache->slot[i + j].valid = true;
+            cache->slot[i + j].dirty = false;
+            cache_touch(cache, i + j);
+        }
+    }
+    cache_touch(cache, i);
+    memcpy(buff, cache_data(vfs, i), block_size);
+    return RES_OK;
+}
+
+STATIC DRESULT cache_write(fs_user_mount_t *vfs, const BYTE *buff, DWORD sector, UINT count) {
+    vfs_fat_cache_t *cache = vfs->cache;
+    size_t block_size = vfs->blockdev.block_size;
+
+    if (count > 1) {
+        // Whole clusters of file data go straight to the device.
+        if (mp_vfs_blockdev_write(&vfs->blockdev, sector, count, buff) != 0) {
+            return RES_ERROR;
+        }
+        cache->blocks_written += count;
+        for (size_t i = 0; i < CACHE_SLOTS; i++) {
+            if (cache->slot[i].valid && cache->slot[i].sector - sector < count) {
+                memcpy(cache_data(vfs, i), buff + (cache->slot[i].sector - sector) * block_size, block_size);
+                cache->slot[i].dirty = false;
+            }
+        }
+        return RES_OK;
+    }
+
+    int i = cache_find(cache, sector);
+    if (i < 0) {
+        i = cache_claim(vfs, sector, 1);
+        if (i < 0) {
+            return RES_ERROR;
+        }
+        cache->slot[i].sector = sector;
+        cache->slot[i].valid = true;
+    }
+    memcpy(cache_data(vfs, i), buff, block_size);
+    cache->slot[i].dirty = true;
+    cache_touch(cache, i);
+    return RES_OK;
+}
+
+#endif
+
 STATIC fs_user_mount_t *disk_get_device(void *bdev) {
     return (fs_user_mount_t *)bdev;
 }
@@ -52,16 +252,17 @@ STATIC fs_user_mount_t *disk_get_device(void *bdev) {
 /* Read Sector(s)                                                        */
 /*-----------------------------------------------------------------------*/
 
-DRESULT disk_read(
-    bdev_t pdrv,      /* Physical drive nmuber (0..) */
+STATIC DRESULT disk_read_device(
+    fs_user_mount_t *vfs,
     BYTE *buff,        /* Data buffer to store read data */
     DWORD sector,    /* Sector address (LBA) */
     UINT count        /* Number of sectors to read (1..128) */
     ) {
-    fs_user_mount_t *vfs = disk_get_device(pdrv);
-    if (vfs == NULL) {
-        return RES_PARERR;
+    #if MICROPY_FATFS_CACHE_SECTORS
+    if (vfs->cache != NULL) {
+        return cache_read(vfs, buff, sector, count);
     }
+    #endif
 
     int ret = mp_vfs_blockdev_read(&vfs->blockdev, sector, count, buff);
 
@@ -72,16 +273,19 @@ DRESULT disk_read(
 /* Write Sector(s)                                                       */
 /*-----------------------------------------------------------------------*/
 
-DRESULT disk_write(
-    bdev_t pdrv,          /* Physical drive nmuber (0..) */
+STATIC DRESULT disk_write_device(
+    fs_user_mount_t *vfs,
     const BYTE *buff,    /* Data to be written */
     DWORD sector,        /* Sector address (LBA) */
     UINT count            /* Number of sectors to write (1..128) */
     ) {
-    fs_user_mount_t *vfs = disk_get_device(pdrv);
-    if (vfs == NULL) {
-        return RES_PARERR;
+    vfs_fat_write_count++;
+
+    #if MICROPY_FATFS_CACHE_SECTORS
+    if (vfs->cache != NULL && vfs->blockdev.writeblocks[0] != MP_OBJ_NULL) {
+        return cache_write(vfs, buff, sector, count);
     }
+    #endif
 
     int ret = mp_vfs_blockdev_write(&vfs->blockdev, sector, count, buff);
 
@@ -98,15 +302,17 @@ DRESULT disk_write(
 /* Miscellaneous Functions                                               */
 /*-----------------------------------------------------------------------*/
 
-DRESULT disk_ioctl(
-    bdev_t pdrv,      /* Physical drive nmuber (0..) */
+STATIC DRESULT disk_ioctl_device(
+    fs_user_mount_t *vfs,
     BYTE cmd,        /* Control code */
     void *buff        /* Buffer to send/receive control data */
     ) {
-    fs_user_mount_t *vfs = disk_get_device(pdrv);
-    if (vfs == NULL) {
-        return RES_PARERR;
+    #if MICROPY_FATFS_CACHE_SECTORS
+    // Anything FatFs has written must reach the device before it is synced.
+    if (cmd == CTRL_SYNC && vfs->cache != NULL && cache_write_back(vfs, 0, MICROPY_FATFS_CACHE_SECTORS) != 0) {
+        return RES_ERROR;
     }
+    #endif
 
     // First part: call the relevant method of the underlying block device
     static const uint8_t op_map[8] = {
@@ -138,6 +344,17 @@ DRESULT disk_ioctl(
             } else {
                 *((WORD *)buff) = mp_obj_get_int(ret);
             }
+            #if MICROPY_FATFS_CACHE_SECTORS
+            // The cache is laid out in sectors, so start again if they change size.
+            if (vfs->cache != NULL && vfs->blockdev.block_size != *((WORD *)buff)) {
+                if (cache_write_back(vfs, 0, MICROPY_FATFS_CACHE_SECTORS) != 0) {
+                    return RES_ERROR;
+                }
+                for (size_t i = 0; i < MICROPY_FATFS_CACHE_SECTORS; i++) {
+                    vfs->cache->slot[i].valid = false;
+                }
+            }
+            #endif
             // need to store ssize because we use it in disk_read/disk_write
             vfs->blockdev.block_size = *((WORD *)buff);
             return RES_OK;
@@ -167,4 +384,54 @@ DRESULT disk_ioctl(
     }
 }
 
+/*-----------------------------------------------------------------------*/
+/* Entry points from FatFs                                               */
+/*-----------------------------------------------------------------------*/
+
+// A block device written in Python can raise, so the count of calls in
+// progress is also dropped if one unwinds through here.
+STATIC void disk_busy_nlr_jump_callback(void *ctx) {
+    (void)ctx;
+    vfs_fat_disk_busy--;
+}
+
+DRESULT disk_read(bdev_t pdrv, BYTE *buff, DWORD sector, UINT count) {
+    fs_user_mount_t *vfs = disk_get_device(pdrv);
+    if (vfs == NULL) {
+        return RES_PARERR;
+    }
+    nlr_jump_callback_node_t busy;
+    vfs_fat_disk_busy++;
+    nlr_push_jump_callback(&busy, disk_busy_nlr_jump_callback);
+    DRESULT res = disk_read_device(vfs, buff, sector, count);
+    nlr_pop_jump_callback(true);
+    return res;
+}
+
+DRESULT disk_write(bdev_t pdrv, const BYTE *buff, DWORD sector, UINT count) {
+    fs_user_mount_t *vfs = disk_get_device(pdrv);
+    if (vfs == NULL) {
+        return RES_PARERR;
+    }
+    nlr_jump_callback_node_t busy;
+    vfs_fat_disk_busy++;
+    nlr_push_jump_callback(&busy, disk_busy_nlr_jump_callback);
+    DRESULT res = disk_write_device(vfs, buff, sector, count);
+    nlr_pop_jump_callback(true);
+    return res;
+}
+
+DRESULT disk_ioctl(bdev_t pdrv, BYTE cmd, void *buff) {
+    fs_user_mount_t *vfs = disk_get_device(pdrv);
+    if (vfs == NULL) {
+        return RES_PARERR;
+    }
+    nlr_jump_callback_node_t busy;
+    vfs_fat_disk_busy++;
+    nlr_push_jump_callback(&busy, disk_busy_nlr_jump_callback);
+    DRESULT res = disk_ioctl_device(vfs, cmd, buff);
+    nlr_pop_jump_callback(true);
+    return res;
+}
+
 #endif // MICROPY_VFS && MICROPY_VFS_FAT
@@ -33,6 +33,7 @@
 #include "py/runtime.h"
 #include "py/stream.h"
 #include "py/mperrno.h"
+#include "py/mphal.h"
 #include "lib/oofatfs/ff.h"
 #include "extmod/vfs_fat.h"
 #include "supervisor/filesystem.h"
@@ -191,9 +192,217 @@ MP_DEFINE_CONST_OBJ_TYPE(
     locals_dict, &vfs_fat_rawfile_locals_dict
     );
 
+#if MICROPY_VFS_FAT_LOG
+
+// Log files with records waiting for their timed commit, so that the background
+// task can find them and the GC keeps them until then.
+MP_REGISTER_ROOT_POINTER(struct _vfs_fat_log_obj_t *vfs_fat_log_pending);
+
+STATIC void log_set_pending(vfs_fat_log_obj_t *self, bool pending) {
+    if (self->pending == pending) {
+        return;
+    }
+    vfs_fat_log_obj_t **p = &MP_STATE_VM(vfs_fat_log_pending);
+    if (pending) {
+        self->next = *p;
+        *p = self;
+    } else {
+        while (*p != self) {
+            p = &(*p)->next;
+        }
+        *p = self->next;
+        self->next = NULL;
+    }
+    self->pending = pending;
+    filesystem_log_pending(pending);
+}
+
+STATIC void log_truncate(FIL *fp, FSIZE_t size) {
+    f_lseek(fp, size);
+    f_truncate(fp);
+}
+
+// Append records to the file and sync it twice: first the data, then the file
+// size in the directory entry. If power fails in between, the file still ends
+// after the last whole record of the previous commit.
+STATIC int log_write_out(vfs_fat_log_obj_t *self, const void *buf, size_t size) {
+    FIL *fp = &self->file.fp;
+    FSIZE_t start = f_tell(fp);
+    UINT sz_out;
+    FRESULT res = f_write(fp, buf, size, &sz_out);
+    if (res != FR_OK || sz_out != size) {
+        // Don't leave part of a record behind.
+        log_truncate(fp, start);
+        // The FatFS documentation says that a short write means disk full.
+        return res != FR_OK ? fresult_to_errno_table[res] : MP_ENOSPC;
+    }
+    res = f_sync_data(fp);
+    if (res == FR_OK) {
+        res = f_sync(fp);
+    }
+    return fresult_to_errno_table[res];
+}
+
+STATIC int log_commit(vfs_fat_log_obj_t *self) {
+    if (self->len == 0) {
+        return 0;
+    }
+    int errcode = log_write_out(self, self->buf, self->len);
+    if (errcode == 0) {
+        self->len = 0;
+        log_set_pending(self, false);
+    }
+    return errcode;
+}
+
+void vfs_fat_log_background(void) {
+    // FatFs is in the middle of a call that is waiting for its block device.
+    if (vfs_fat_disk_busy > 0) {
+        return;
+    }
+    mp_uint_t now = mp_hal_ticks_ms();
+    vfs_fat_log_obj_t *self = MP_STATE_VM(vfs_fat_log_pending);
+    while (self != NULL) {
+        vfs_fat_log_obj_t *next = self->next;
+        if (now - self->first_ms >= MICROPY_VFS_FAT_LOG_COMMIT_MS) {
+            // A block device written in Python can raise. That mustn't escape
+            // from a background task, so catch it and treat it as a failed
+            // commit, taking out anything it left behind.
+            FSIZE_t start = f_tell(&self->file.fp);
+            int errcode;
+            nlr_buf_t nlr;
+            if (nlr_push(&nlr) == 0) {
+                errcode = log_commit(self);
+                nlr_pop();
+            } else {
+                errcode = MP_EIO;
+                if (nlr_push(&nlr) == 0) {
+                    log_truncate(&self->file.fp, start);
+                    nlr_pop();
+                }
+            }
+            if (errcode != 0) {
+                // Keep the records; the next write() or flush() reports the error.
+                self->first_ms = now;
+            }
+        }
+        self = next;
+    }
+}
+
+STATIC mp_uint_t log_obj_write(mp_obj_t self_in, const void *buf, mp_uint_t size, int *errcode) {
+    vfs_fat_log_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_uint_t now = mp_hal_ticks_ms();
+    if (self->len > 0 && (self->len + size > self->size || now - self->first_ms >= MICROPY_VFS_FAT_LOG_COMMIT_MS)) {
+        *errcode = log_commit(self);
+        if (*errcode != 0) {
+            return MP_STREAM_ERROR;
+        }
+    }
+    if (size > self->size) {
+        // A record larger than the buffer is committed on its own.
+        *errcode = log_write_out(self, buf, size);
+        return *errcode != 0 ? MP_STREAM_ERROR : size;
+    }
+    if (self->len == 0) {
+        self->first_ms = now;
+        log_set_pending(self, true);
+    }
+    memcpy(self->buf + self->len, buf, size);
+    self->len += size;
+    if (self->len == self->size) {
+        *errcode = log_commit(self);
+        if (*errcode != 0) {
+            return MP_STREAM_ERROR;
+        }
+    }
+    return size;
+}
+
+STATIC mp_uint_t log_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+    vfs_fat_log_obj_t *self = MP_OBJ_TO_PTR(o_in);
+
+    if (request == MP_STREAM_SEEK) {
+        // Records only go at the end, so the position can be read but not moved.
+        struct mp_stream_seek_t *s = (struct mp_stream_seek_t *)(uintptr_t)arg;
+        if (s->offset != 0 || s->whence == 0) {
+            *errcode = MP_EINVAL;
+            return MP_STREAM_ERROR;
+        }
+        s->offset = f_tell(&self->file.fp) + self->len;
+        return 0;
+
+    } else if (request == MP_STREAM_FLUSH) {
+        *errcode = log_commit(self);
+        return *errcode != 0 ? MP_STREAM_ERROR : 0;
+
+    } else if (request == MP_STREAM_CLOSE) {
+        if (self->file.fp.obj.fs == NULL) {
+            return 0;
+        }
+        *errcode = log_commit(self);
+        log_set_pending(self, false);
+        FRESULT res = f_close(&self->file.fp);
+        if (*errcode == 0) {
+            *errcode = fresult_to_errno_table[res];
+        }
+        return *errcode != 0 ? MP_STREAM_ERROR : 0;
+
+    } else {
+        *errcode = MP_EINVAL;
+        return MP_STREAM_ERROR;
+    }
+}
+
+STATIC const mp_rom_map_elem_t vfs_fat_log_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mp_stream_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&mp_stream_flush_obj) },
+    { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&mp_stream_close_obj) },
+    { MP_ROM_QSTR(MP_QSTR_seek), MP_ROM_PTR(&mp_stream_seek_obj) },
+    { MP_ROM_QSTR(MP_QSTR_tell), MP_ROM_PTR(&mp_stream_tell_obj) },
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&mp_stream_close_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&mp_identity_obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&mp_stream___exit___obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(vfs_fat_log_locals_dict, vfs_fat_log_locals_dict_table);
+
+STATIC const mp_stream_p_t vfs_fat_log_fileio_stream_p = {
+    .write = log_obj_write,
+    .ioctl = log_obj_ioctl,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    mp_type_vfs_fat_log_fileio,
+    MP_QSTR_FileIO,
+    MP_TYPE_FLAG_NONE,
+    print, file_obj_print,
+    protocol, &vfs_fat_log_fileio_stream_p,
+    locals_dict, &vfs_fat_log_locals_dict
+    );
+
+STATIC const mp_stream_p_t vfs_fat_log_textio_stream_p = {
+    .write = log_obj_write,
+    .ioctl = log_obj_ioctl,
+    .is_text = true,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    mp_type_vfs_fat_log_textio,
+    MP_QSTR_TextIOWrapper,
+    MP_TYPE_FLAG_NONE,
+    print, file_obj_print,
+    protocol, &vfs_fat_log_textio_stream_p,
+    locals_dict, &vfs_fat_log_locals_dict
+    );
+
+#endif
+
 // Factory function for I/O stream classes
-STATIC mp_obj_t fat_vfs_open(mp_obj_t self_in, mp_obj_t path_in, mp_obj_t mode_in) {
-    fs_user_mount_t *self = MP_OBJ_TO_PTR(self_in);
+STATIC mp_obj_t fat_vfs_open(size_t n_args, const mp_obj_t *args) {
+    fs_user_mount_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_obj_t path_in = args[1];
+    mp_obj_t mode_in = args[2];
 
     const mp_obj_type_t *type = &mp_type_vfs_fat_textio;
     int mode = 0;
@@ -248,7 +457,24 @@ STATIC mp_obj_t fat_vfs_open(mp_obj_t self_in, mp_obj_t path_in, mp_obj_t mode_i
     }
 
 
-    pyb_file_obj_t *o = m_new_obj_with_finaliser(pyb_file_obj_t);
+    pyb_file_obj_t *o;
+    #if MICROPY_VFS_FAT_LOG
+    // CIRCUITPY-CHANGE: open(path, "a", buffering=n) makes a log file.
+    mp_int_t buffering = n_args > 3 ? mp_obj_get_int(args[3]) : -1;
+    if (buffering > 1 && mode == (FA_WRITE | FA_OPEN_ALWAYS)) {
+        type = type == &mp_type_vfs_fat_textio ? &mp_type_vfs_fat_log_textio : &mp_type_vfs_fat_log_fileio;
+        vfs_fat_log_obj_t *log = m_new_obj_with_finaliser(vfs_fat_log_obj_t);
+        log->next = NULL;
+        log->buf = m_new(uint8_t, buffering);
+        log->size = buffering;
+        log->len = 0;
+        log->pending = false;
+        o = &log->file;
+    } else
+    #endif
+    {
+        o = m_new_obj_with_finaliser(pyb_file_obj_t);
+    }
     o->base.type = type;
 
     const char *fname = mp_obj_str_get_str(path_in);
@@ -285,6 +511,6 @@ STATIC mp_obj_t fat_vfs_open(mp_obj_t self_in, mp_obj_t path_in, mp_obj_t mode_i
 
     return MP_OBJ_FROM_PTR(o);
 }
-MP_DEFINE_CONST_FUN_OBJ_3(fat_vfs_open_obj, fat_vfs_open);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(fat_vfs_open_obj, 3, 4, fat_vfs_open);
 
 #endif // MICROPY_VFS && MICROPY_VFS_FAT
@@ -24,6 +24,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "py/runtime.h"
 #include "py/mphal.h"
 
@@ -33,7 +35,7 @@
 #include "extmod/vfs.h"
 #include "extmod/vfs_lfs.h"
 
-enum { LFS_MAKE_ARG_bdev, LFS_MAKE_ARG_readsize, LFS_MAKE_ARG_progsize, LFS_MAKE_ARG_lookahead, LFS_MAKE_ARG_mtime };
+enum { LFS_MAKE_ARG_bdev, LFS_MAKE_ARG_readsize, LFS_MAKE_ARG_progsize, LFS_MAKE_ARG_lookahead, LFS_MAKE_ARG_mtime, LFS_MAKE_ARG_cachesize, LFS_MAKE_ARG_readahead };
 
 static const mp_arg_t lfs_make_allowed_args[] = {
     { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
@@ -41,8 +43,134 @@ static const mp_arg_t lfs_make_allowed_args[] = {
     { MP_QSTR_progsize, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 32} },
     { MP_QSTR_lookahead, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 32} },
     { MP_QSTR_mtime, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+    { MP_QSTR_cachesize, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    { MP_QSTR_readahead, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
 };
 
+#if MICROPY_VFS_LFS_READAHEAD_SLOTS
+
+// littlefs reads a file through a buffer of only cache_size bytes, so reading
+// a large file costs a block device call every cache_size bytes. This cache
+// fetches aligned chunks of a larger size instead and serves littlefs' reads
+// from them. Writes go straight through and update any cached copy, so the
+// cache never holds data the device doesn't.
+typedef struct _vfs_lfs_readahead_t {
+    size_t chunk_size;
+    uint32_t clock;
+    // Reads asked for by littlefs that were or were not found in the cache,
+    // and bytes actually transferred to and from the block device.
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t bytes_read;
+    uint32_t bytes_written;
+    struct {
+        uint32_t block;
+        uint32_t off;
+        uint32_t size;
+        // 0 if the slot is empty.
+        uint32_t used;
+    } slot[MICROPY_VFS_LFS_READAHEAD_SLOTS];
+    // MICROPY_VFS_LFS_READAHEAD_SLOTS chunks of chunk_size bytes.
+    uint8_t data[];
+} vfs_lfs_readahead_t;
+
+STATIC vfs_lfs_readahead_t *vfs_lfs_readahead_new(size_t chunk_size) {
+    if (chunk_size == 0) {
+        return NULL;
+    }
+    // The filesystem still works without the cache, so don't fail if there's no room for it.
+    vfs_lfs_readahead_t *ra = m_new_obj_var_maybe(vfs_lfs_readahead_t, uint8_t, MICROPY_VFS_LFS_READAHEAD_SLOTS * chunk_size);
+    if (ra != NULL) {
+        memset(ra, 0, sizeof(vfs_lfs_readahead_t));
+        ra->chunk_size = chunk_size;
+    }
+    return ra;
+}
+
+STATIC int vfs_lfs_readahead_read(vfs_lfs_readahead_t *ra, mp_vfs_blockdev_t *bdev, uint32_t block, uint32_t off, uint8_t *buf, size_t size) {
+    if (size >= ra->chunk_size) {
+        // Nothing to gain from the cache, and the cached copies are never newer than the device.
+        ra->misses++;
+        ra->bytes_read += size;
+        return mp_vfs_blockdev_read_ext(bdev, block, off, size, buf);
+    }
+    while (size > 0) {
+        uint32_t start = off - off % ra->chunk_size;
+        size_t i;
+        for (i = 0; i < MICROPY_VFS_LFS_READAHEAD_SLOTS; i++) {
+            if (ra->slot[i].used && ra->slot[i].block == block && ra->slot[i].off == start) {
+                break;
+            }
+        }
+        if (i < MICROPY_VFS_LFS_READAHEAD_SLOTS) {
+            ra->hits++;
+        } else {
+            ra->misses++;
+            // Replace the least recently used chunk.
+            i = 0;
+            for (size_t j = 1; j < MICROPY_VFS_LFS_READAHEAD_SLOTS; j++) {
+                if (ra->slot[j].used < ra->slot[i].used) {
+                    i = j;
+                }
+            }
+            uint32_t n = MIN(ra->chunk_size, bdev->block_size - start);
+            ra->slot[i].used = 0;
+            int ret = mp_vfs_blockdev_read_ext(bdev, block, start, n, ra->data + i * ra->chunk_size);
+            if (ret != 0) {
+                return ret;
+            }
+            ra->bytes_read += n;
+            ra->slot[i].block = block;
+            ra->slot[i].off = start;
+            ra->slot[i].size = n;
+        }
+        ra->slot[i].used = ++ra->clock;
+        size_t n = MIN(size, start + ra->slot[i].size - off);
+        memcpy(buf, ra->data + i * ra->chunk_size + (off - start), n);
+        buf += n;
+        off += n;
+        size -= n;
+    }
+    return 0;
+}
+
+STATIC void vfs_lfs_readahead_prog(vfs_lfs_readahead_t *ra, uint32_t block, uint32_t off, const uint8_t *buf, size_t size) {
+    ra->bytes_written += size;
+    for (size_t i = 0; i < MICROPY_VFS_LFS_READAHEAD_SLOTS; i++) {
+        if (!ra->slot[i].used || ra->slot[i].block != block) {
+            continue;
+        }
+        uint32_t from = MAX(off, ra->slot[i].off);
+        uint32_t to = MIN(off + size, ra->slot[i].off + ra->slot[i].size);
+        if (from < to) {
+            memcpy(ra->data + i * ra->chunk_size + (from - ra->slot[i].off), buf + (from - off), to - from);
+        }
+    }
+}
+
+STATIC void vfs_lfs_readahead_erase(vfs_lfs_readahead_t *ra, uint32_t block) {
+    for (size_t i = 0; i < MICROPY_VFS_LFS_READAHEAD_SLOTS; i++) {
+        if (ra->slot[i].block == block) {
+            ra->slot[i].used = 0;
+        }
+    }
+}
+
+STATIC mp_obj_t vfs_lfs_readahead_stats(vfs_lfs_readahead_t *ra) {
+    if (ra == NULL) {
+        return mp_const_none;
+    }
+    mp_obj_t tuple[4] = {
+        mp_obj_new_int_from_uint(ra->hits),
+        mp_obj_new_int_from_uint(ra->misses),
+        mp_obj_new_int_from_uint(ra->bytes_read),
+        mp_obj_new_int_from_uint(ra->bytes_written),
+    };
+    return mp_obj_new_tuple(4, tuple);
+}
+
+#endif
+
 #if MICROPY_VFS_LFS1
 
 #include "lib/littlefs/lfs1.h"
@@ -60,6 +188,10 @@ typedef struct _mp_obj_vfs_lfs1_t {
     mp_obj_base_t base;
     mp_vfs_blockdev_t blockdev;
     vstr_t cur_dir;
+    #if MICROPY_VFS_LFS_READAHEAD_SLOTS
+    // NULL if the mount has no read-ahead cache.
+    vfs_lfs_readahead_t *readahead;
+    #endif
     struct lfs1_config config;
     lfs1_t lfs;
 } mp_obj_vfs_lfs1_t;
@@ -110,6 +242,10 @@ typedef struct _mp_obj_vfs_lfs2_t {
     mp_vfs_blockdev_t blockdev;
     bool enable_mtime;
     vstr_t cur_dir;
+    #if MICROPY_VFS_LFS_READAHEAD_SLOTS
+    // NULL if the mount has no read-ahead cache.
+    vfs_lfs_readahead_t *readahead;
+    #endif
     struct lfs2_config config;
     lfs2_t lfs;
 } mp_obj_vfs_lfs2_t;
@@ -28,6 +28,13 @@
 
 #include "py/obj.h"
 
+// Number of chunks kept by the read-ahead cache that a VfsLfs1 or VfsLfs2
+// created with readahead=N puts between littlefs and the block device. Each
+// chunk is N bytes and the chunks are shared by all files on the mount.
+#ifndef MICROPY_VFS_LFS_READAHEAD_SLOTS
+#define MICROPY_VFS_LFS_READAHEAD_SLOTS (4)
+#endif
+
 extern const mp_obj_type_t mp_type_vfs_lfs1;
 extern const mp_obj_type_t mp_type_vfs_lfs1_fileio;
 extern const mp_obj_type_t mp_type_vfs_lfs1_textio;
@@ -44,7 +44,8 @@
 #endif
 
 STATIC int MP_VFS_LFSx(dev_ioctl)(const struct LFSx_API (config) * c, int cmd, int arg, bool must_return_int) {
-    mp_obj_t ret = mp_vfs_blockdev_ioctl(c->context, cmd, arg);
+    MP_OBJ_VFS_LFSx *self = c->context;
+    mp_obj_t ret = mp_vfs_blockdev_ioctl(&self->blockdev, cmd, arg);
     int ret_i = 0;
     if (must_return_int || ret != mp_const_none) {
         ret_i = mp_obj_get_int(ret);
@@ -53,14 +54,33 @@ STATIC int MP_VFS_LFSx(dev_ioctl)(const struct LFSx_API (config) * c, int cmd, i
 }
 
 STATIC int MP_VFS_LFSx(dev_read)(const struct LFSx_API (config) * c, LFSx_API(block_t) block, LFSx_API(off_t) off, void *buffer, LFSx_API(size_t) size) {
-    return mp_vfs_blockdev_read_ext(c->context, block, off, size, buffer);
+    MP_OBJ_VFS_LFSx *self = c->context;
+    #if MICROPY_VFS_LFS_READAHEAD_SLOTS
+    if (self->readahead != NULL) {
+        return vfs_lfs_readahead_read(self->readahead, &self->blockdev, block, off, buffer, size);
+    }
+    #endif
+    return mp_vfs_blockdev_read_ext(&self->blockdev, block, off, size, buffer);
 }
 
 STATIC int MP_VFS_LFSx(dev_prog)(const struct LFSx_API (config) * c, LFSx_API(block_t) block, LFSx_API(off_t) off, const void *buffer, LFSx_API(size_t) size) {
-    return mp_vfs_blockdev_write_ext(c->context, block, off, size, buffer);
+    MP_OBJ_VFS_LFSx *self = c->context;
+    int ret = mp_vfs_blockdev_write_ext(&self->blockdev, block, off, size, buffer);
+    #if MICROPY_VFS_LFS_READAHEAD_SLOTS
+    if (ret == 0 && self->readahead != NULL) {
+        vfs_lfs_readahead_prog(self->readahead, block, off, buffer, size);
+    }
+    #endif
+    return ret;
 }
 
 STATIC int MP_VFS_LFSx(dev_erase)(const struct LFSx_API (config) * c, LFSx_API(block_t) block) {
+    #if MICROPY_VFS_LFS_READAHEAD_SLOTS
+    MP_OBJ_VFS_LFSx *self = c->context;
+    if (self->readahead != NULL) {
+        vfs_lfs_readahead_erase(self->readahead, block);
+    }
+    #endif
     return MP_VFS_LFSx(dev_ioctl)(c, MP_BLOCKDEV_IOCTL_BLOCK_ERASE, block, true);
 }
 
@@ -68,14 +88,14 @@ STATIC int MP_VFS_LFSx(dev_sync)(const struct LFSx_API (config) * c) {
     return MP_VFS_LFSx(dev_ioctl)(c, MP_BLOCKDEV_IOCTL_SYNC, 0, false);
 }
 
-STATIC void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size_t read_size, size_t prog_size, size_t lookahead) {
+STATIC void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size_t read_size, size_t prog_size, size_t lookahead, size_t cache_size, mp_int_t readahead) {
     self->blockdev.flags = MP_BLOCKDEV_FLAG_FREE_OBJ;
     mp_vfs_blockdev_init(&self->blockdev, bdev);
 
     struct LFSx_API (config) * config = &self->config;
     memset(config, 0, sizeof(*config));
 
-    config->context = &self->blockdev;
+    config->context = self;
 
     config->read = MP_VFS_LFSx(dev_read);
     config->prog = MP_VFS_LFSx(dev_prog);
@@ -92,14 +112,33 @@ STATIC void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size
     config->block_size = bs;
     config->block_count = bc;
 
+    #if MICROPY_VFS_LFS_READAHEAD_SLOTS
+    if (readahead != 0) {
+        // Chunks are whole reads that don't cross a block, and their size sets
+        // how much is allocated, so check it before allocating.
+        mp_arg_validate_int_range(readahead, 1, bs, MP_QSTR_readahead);
+        if (readahead % read_size != 0) {
+            mp_arg_error_invalid(MP_QSTR_readahead);
+        }
+    }
+    self->readahead = vfs_lfs_readahead_new(readahead);
+    #endif
+
     #if LFS_BUILD_VERSION == 1
+    (void)cache_size;
     config->lookahead = lookahead;
     config->read_buffer = m_new(uint8_t, config->read_size);
     config->prog_buffer = m_new(uint8_t, config->prog_size);
     config->lookahead_buffer = m_new(uint8_t, config->lookahead / 8);
     #else
     config->block_cycles = 100;
-    config->cache_size = 4 * MAX(read_size, prog_size);
+    if (cache_size == 0) {
+        cache_size = 4 * MAX(read_size, prog_size);
+    } else if (cache_size % read_size != 0 || cache_size % prog_size != 0 || bs % cache_size != 0) {
+        // littlefs checks this only with assertions, which are compiled out.
+        mp_arg_error_invalid(MP_QSTR_cachesize);
+    }
+    config->cache_size = cache_size;
     config->lookahead_size = lookahead;
     config->read_buffer = m_new(uint8_t, config->cache_size);
     config->prog_buffer = m_new(uint8_t, config->cache_size);
@@ -132,7 +171,8 @@ STATIC mp_obj_t MP_VFS_LFSx(make_new)(const mp_obj_type_t * type, size_t n_args,
     self->enable_mtime = args[LFS_MAKE_ARG_mtime].u_bool;
     #endif
     MP_VFS_LFSx(init_config)(self, args[LFS_MAKE_ARG_bdev].u_obj,
-        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int);
+        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int,
+        args[LFS_MAKE_ARG_cachesize].u_int, args[LFS_MAKE_ARG_readahead].u_int);
     int ret = LFSx_API(mount)(&self->lfs, &self->config);
     if (ret < 0) {
         mp_raise_OSError(-ret);
@@ -145,8 +185,10 @@ STATIC mp_obj_t MP_VFS_LFSx(mkfs)(size_t n_args, const mp_obj_t *pos_args, mp_ma
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(lfs_make_allowed_args), lfs_make_allowed_args, args);
 
     MP_OBJ_VFS_LFSx self;
+    // A read-ahead cache is no use for formatting.
     MP_VFS_LFSx(init_config)(&self, args[LFS_MAKE_ARG_bdev].u_obj,
-        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int);
+        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int,
+        args[LFS_MAKE_ARG_cachesize].u_int, 0);
     int ret = LFSx_API(format)(&self.lfs, &self.config);
     if (ret < 0) {
         mp_raise_OSError(-ret);
@@ -468,6 +510,14 @@ STATIC mp_obj_t MP_VFS_LFSx(umount)(mp_obj_t self_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(MP_VFS_LFSx(umount_obj), MP_VFS_LFSx(umount));
 
+#if MICROPY_VFS_LFS_READAHEAD_SLOTS
+STATIC mp_obj_t MP_VFS_LFSx(cache_stats)(mp_obj_t self_in) {
+    MP_OBJ_VFS_LFSx *self = MP_OBJ_TO_PTR(self_in);
+    return vfs_lfs_readahead_stats(self->readahead);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(MP_VFS_LFSx(cache_stats_obj), MP_VFS_LFSx(cache_stats));
+#endif
+
 STATIC const mp_rom_map_elem_t MP_VFS_LFSx(locals_dict_table)[] = {
     { MP_ROM_QSTR(MP_QSTR_mkfs), MP_ROM_PTR(&MP_VFS_LFSx(mkfs_obj)) },
     { MP_ROM_QSTR(MP_QSTR_open), MP_ROM_PTR(&MP_VFS_LFSx(open_obj)) },
@@ -482,6 +532,9 @@ STATIC const mp_rom_map_elem_t MP_VFS_LFSx(locals_dict_table)[] = {
     { MP_ROM_QSTR(MP_QSTR_statvfs), MP_ROM_PTR(&MP_VFS_LFSx(statvfs_obj)) },
     { MP_ROM_QSTR(MP_QSTR_mount), MP_ROM_PTR(&MP_VFS_LFSx(mount_obj)) },
     { MP_ROM_QSTR(MP_QSTR_umount), MP_ROM_PTR(&MP_VFS_LFSx(umount_obj)) },
+    #if MICROPY_VFS_LFS_READAHEAD_SLOTS
+    { MP_ROM_QSTR(MP_QSTR_cache_stats), MP_ROM_PTR(&MP_VFS_LFSx(cache_stats_obj)) },
+    #endif
 };
 STATIC MP_DEFINE_CONST_DICT(MP_VFS_LFSx(locals_dict), MP_VFS_LFSx(locals_dict_table));
 
@@ -41,6 +41,12 @@
 #include <poll.h>
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_VFS_POSIX_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 typedef struct _mp_obj_vfs_posix_file_t {
     mp_obj_base_t base;
     int fd;
@@ -237,8 +243,160 @@ STATIC mp_uint_t vfs_posix_file_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_
     }
 }
 
+// CIRCUITPY-CHANGE: read-only or shared writable mappings of a file, exposed
+// through the buffer protocol so that they can be processed without copying.
+#if MICROPY_VFS_POSIX_MMAP
+typedef struct _mp_obj_vfs_posix_mmap_t {
+    mp_obj_base_t base;
+    // Start of the mapping, which begins at a page boundary; NULL if empty.
+    uint8_t *addr;
+    size_t map_len;
+    // Where the requested range starts within the mapping.
+    size_t start;
+    size_t len;
+    bool writable;
+    bool closed;
+} mp_obj_vfs_posix_mmap_t;
+
+STATIC mp_obj_vfs_posix_mmap_t *vfs_posix_mmap_get(mp_obj_t self_in) {
+    mp_obj_vfs_posix_mmap_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->closed) {
+        mp_raise_ValueError(MP_ERROR_TEXT("mmap closed"));
+    }
+    return self;
+}
+
+// Memoryviews of the mapping may outlive close(), and don't tell the mapping
+// when they're gone, so rather than unmapping the range, replace it with
+// anonymous memory with the same protection. The file is released and old
+// views read zeros instead of faulting. The address range stays reserved, but
+// the anonymous pages take no memory until an old view writes to them. If the
+// range can't be replaced, unmap it anyway so that the file isn't kept open.
+STATIC mp_obj_t vfs_posix_mmap_close(mp_obj_t self_in) {
+    mp_obj_vfs_posix_mmap_t *self = MP_OBJ_TO_PTR(self_in);
+    uint8_t *addr = self->closed ? NULL : self->addr;
+    self->addr = NULL;
+    self->closed = true;
+    if (addr != NULL) {
+        int prot = self->writable ? PROT_READ | PROT_WRITE : PROT_READ;
+        if (mmap(addr, self->map_len, prot, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) == MAP_FAILED
+            && munmap(addr, self->map_len) != 0) {
+            mp_raise_OSError(errno);
+        }
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(vfs_posix_mmap_close_obj, vfs_posix_mmap_close);
+
+STATIC mp_obj_t vfs_posix_mmap___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    return vfs_posix_mmap_close(args[0]);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(vfs_posix_mmap___exit___obj, 4, 4, vfs_posix_mmap___exit__);
+
+STATIC mp_obj_t vfs_posix_mmap_flush(mp_obj_t self_in) {
+    mp_obj_vfs_posix_mmap_t *self = vfs_posix_mmap_get(self_in);
+    if (self->writable && self->addr != NULL) {
+        int ret;
+        MP_HAL_RETRY_SYSCALL(ret, msync(self->addr, self->map_len, MS_SYNC), mp_raise_OSError(err));
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(vfs_posix_mmap_flush_obj, vfs_posix_mmap_flush);
+
+STATIC mp_obj_t vfs_posix_mmap_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
+    if (op == MP_UNARY_OP_LEN) {
+        return mp_obj_new_int_from_uint(vfs_posix_mmap_get(self_in)->len);
+    }
+    return MP_OBJ_NULL; // op not supported
+}
+
+STATIC mp_int_t vfs_posix_mmap_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    mp_obj_vfs_posix_mmap_t *self = vfs_posix_mmap_get(self_in);
+    if ((flags & MP_BUFFER_WRITE) && !self->writable) {
+        return 1;
+    }
+    bufinfo->buf = self->addr == NULL ? NULL : self->addr + self->start;
+    bufinfo->len = self->len;
+    bufinfo->typecode = 'B';
+    return 0;
+}
+
+STATIC const mp_rom_map_elem_t vfs_posix_mmap_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&vfs_posix_mmap_close_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&vfs_posix_mmap_flush_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&mp_identity_obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&vfs_posix_mmap___exit___obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(vfs_posix_mmap_locals_dict, vfs_posix_mmap_locals_dict_table);
+
+STATIC MP_DEFINE_CONST_OBJ_TYPE(
+    mp_type_vfs_posix_mmap,
+    MP_QSTR_mmap,
+    MP_TYPE_FLAG_NONE,
+    unary_op, vfs_posix_mmap_unary_op,
+    buffer, vfs_posix_mmap_get_buffer,
+    locals_dict, &vfs_posix_mmap_locals_dict
+    );
+
+// The mapping is only released by close(), not by a finaliser: memoryviews of
+// it don't keep it alive, so unmapping it on collection could leave them
+// pointing at unmapped memory.
+STATIC mp_obj_t vfs_posix_file_mmap(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_length, ARG_offset, ARG_writable };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_length, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_offset, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_writable, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    mp_obj_vfs_posix_file_t *file = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    check_fd_is_open(file);
+
+    struct stat st;
+    if (fstat(file->fd, &st) != 0) {
+        mp_raise_OSError(errno);
+    }
+    mp_int_t offset = mp_arg_validate_int_range(args[ARG_offset].u_int, 0, st.st_size, MP_QSTR_offset);
+    mp_int_t length = mp_arg_validate_int_range(args[ARG_length].u_int, 0, st.st_size - offset, MP_QSTR_length);
+    if (length == 0) {
+        // Map up to the end of the file.
+        length = st.st_size - offset;
+    }
+
+    mp_obj_vfs_posix_mmap_t *self = mp_obj_malloc(mp_obj_vfs_posix_mmap_t, &mp_type_vfs_posix_mmap);
+    self->addr = NULL;
+    self->map_len = 0;
+    self->start = 0;
+    self->len = length;
+    self->writable = args[ARG_writable].u_bool;
+    self->closed = false;
+    if (length > 0) {
+        // mmap() needs a page aligned offset.
+        self->start = offset % sysconf(_SC_PAGESIZE);
+        self->map_len = self->start + length;
+        int prot = self->writable ? PROT_READ | PROT_WRITE : PROT_READ;
+        MP_THREAD_GIL_EXIT();
+        void *addr = mmap(NULL, self->map_len, prot, MAP_SHARED, file->fd, offset - self->start);
+        int err = errno;
+        MP_THREAD_GIL_ENTER();
+        if (addr == MAP_FAILED) {
+            mp_raise_OSError(err);
+        }
+        self->addr = addr;
+    }
+    return MP_OBJ_FROM_PTR(self);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(vfs_posix_file_mmap_obj, 1, vfs_posix_file_mmap);
+#endif
+
 STATIC const mp_rom_map_elem_t vfs_posix_rawfile_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_fileno), MP_ROM_PTR(&vfs_posix_file_fileno_obj) },
+    // CIRCUITPY-CHANGE
+    #if MICROPY_VFS_POSIX_MMAP
+    { MP_ROM_QSTR(MP_QSTR_mmap), MP_ROM_PTR(&vfs_posix_file_mmap_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_read), MP_ROM_PTR(&mp_stream_read_obj) },
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_readline), MP_ROM_PTR(&mp_stream_unbuffered_readline_obj) },
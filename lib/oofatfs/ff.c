@@ -2392,6 +2392,70 @@ static FRESULT dir_read (
 /* Directory handling - Find an object in the directory                  */
 /*-----------------------------------------------------------------------*/
 
+// CIRCUITPY-CHANGE: Remember where names were found, keyed by volume, directory and a
+// hash of the name. A remembered location is only a hint: dir_find() checks the entry
+// there and scans the directory as usual if it does not match, so entries that moved
+// or were deleted never give a wrong answer.
+#if FF_DIR_CACHE
+typedef struct {
+    FATFS* fs;
+    WORD id;        /* Volume mount ID, so that hints do not survive a remount */
+    DWORD sclust;   /* Directory start cluster */
+    DWORD hash;     /* Hash of the name, 0:unused slot */
+    DWORD ofs;      /* Offset of the first entry of the object in the directory */
+} DIRHINT;
+
+static DIRHINT DirHint[FF_DIR_CACHE];
+
+static DWORD dir_hash (DIR* dp)
+{
+    DWORD hash = 2166136261;    /* FNV-1a */
+#if FF_USE_LFN
+    const WCHAR* p;
+
+    for (p = dp->obj.fs->lfnbuf; *p; p++) {
+        hash = (hash ^ ff_wtoupper(*p)) * 16777619;
+    }
+#else
+    UINT i;
+
+    for (i = 0; i < 11; i++) {
+        hash = (hash ^ dp->fn[i]) * 16777619;
+    }
+#endif
+    return hash ? hash : 1;
+}
+
+static DIRHINT* dir_hint (DIR* dp, DWORD hash)
+{
+    DIRHINT* h = &DirHint[hash % FF_DIR_CACHE];
+
+    return (h->hash == hash && h->fs == dp->obj.fs && h->id == dp->obj.fs->id && h->sclust == dp->obj.sclust) ? h : 0;
+}
+
+static void dir_remember (DIR* dp, DWORD hash, DWORD ofs)
+{
+    DIRHINT* h = &DirHint[hash % FF_DIR_CACHE];
+
+    h->fs = dp->obj.fs;
+    h->id = dp->obj.fs->id;
+    h->sclust = dp->obj.sclust;
+    h->hash = hash;
+    h->ofs = ofs;
+}
+
+static void dir_forget (DIR* dp, DWORD ofs)
+{
+    UINT i;
+
+    for (i = 0; i < FF_DIR_CACHE; i++) {
+        if (DirHint[i].ofs == ofs && DirHint[i].fs == dp->obj.fs && DirHint[i].sclust == dp->obj.sclust) {
+            DirHint[i].hash = 0;
+        }
+    }
+}
+#endif
+
 static FRESULT dir_find (   /* FR_OK(0):succeeded, !=0:error */
     DIR* dp                 /* Pointer to the directory object with the file name */
 )
@@ -2402,9 +2466,28 @@ static FRESULT dir_find (   /* FR_OK(0):succeeded, !=0:error */
 #if FF_USE_LFN
     BYTE a, ord, sum;
 #endif
+#if FF_DIR_CACHE
+    DIRHINT* hint = 0;
+    DWORD hash = 0, start = 0;
 
+#if FF_USE_LFN
+    if (!(dp->fn[NSFLAG] & NS_NOLFN) && (!FF_FS_EXFAT || fs->fs_type != FS_EXFAT))
+#endif
+    {
+        hash = dir_hash(dp);
+        hint = dir_hint(dp, hash);
+        if (hint) start = hint->ofs;
+    }
+restart:
+    res = dir_sdi(dp, start);       /* Go to the remembered location or rewind directory object */
+    if (res != FR_OK) {
+        if (start == 0) return res;
+        start = 0; goto restart;
+    }
+#else
     res = dir_sdi(dp, 0);           /* Rewind directory object */
     if (res != FR_OK) return res;
+#endif
 #if FF_FS_EXFAT
     if (fs->fs_type == FS_EXFAT) {  /* On the exFAT volume */
         BYTE nc;
@@ -2453,15 +2536,32 @@ static FRESULT dir_find (   /* FR_OK(0):succeeded, !=0:error */
                 if (ord == 0 && sum == sum_sfn(dp->dir)) break; /* LFN matched? */
                 if (!(dp->fn[NSFLAG] & NS_LOSS) && !mem_cmp(dp->dir, dp->fn, 11)) break;    /* SFN matched? */
                 ord = 0xFF; dp->blk_ofs = 0xFFFFFFFF;   /* Reset LFN sequence */
+#if FF_DIR_CACHE
+                if (start != 0) { start = 0; goto restart; }    /* The remembered object is not the one */
+#endif
             }
         }
 #else       /* Non LFN configuration */
         dp->obj.attr = dp->dir[DIR_Attr] & AM_MASK;
         if (!(dp->dir[DIR_Attr] & AM_VOL) && !mem_cmp(dp->dir, dp->fn, 11)) break;  /* Is it a valid entry? */
+#if FF_DIR_CACHE
+        if (start != 0) { start = 0; goto restart; }    /* The remembered object is not the one */
+#endif
 #endif
         res = dir_next(dp, 0);  /* Next entry */
+#if FF_DIR_CACHE
+        if (res != FR_OK && start != 0) { start = 0; res = FR_OK; goto restart; }
+#endif
     } while (res == FR_OK);
 
+#if FF_DIR_CACHE
+    if (res == FR_NO_FILE && start != 0) { start = 0; goto restart; }   /* Reached the end from the remembered location */
+#if FF_USE_LFN
+    if (res == FR_OK && hash && (!hint || start == 0)) dir_remember(dp, hash, dp->blk_ofs != 0xFFFFFFFF ? dp->blk_ofs : dp->dptr);
+#else
+    if (res == FR_OK && (!hint || start == 0)) dir_remember(dp, hash, dp->dptr);
+#endif
+#endif
     return res;
 }
 
@@ -2479,6 +2579,9 @@ static FRESULT dir_register (   /* FR_OK:succeeded, FR_DENIED:no free entry or t
 {
     FRESULT res;
     FATFS *fs = dp->obj.fs;
+#if FF_DIR_CACHE
+    DWORD ofs;
+#endif
 #if FF_USE_LFN      /* LFN configuration */
     UINT n, nlen, nent;
     BYTE sn[12], sum;
@@ -2535,6 +2638,9 @@ static FRESULT dir_register (   /* FR_OK:succeeded, FR_DENIED:no free entry or t
     /* Create an SFN with/without LFNs. */
     nent = (sn[NSFLAG] & NS_LFN) ? (nlen + 12) / 13 + 1 : 1;    /* Number of entries to allocate */
     res = dir_alloc(dp, nent);      /* Allocate entries */
+#if FF_DIR_CACHE
+    ofs = dp->dptr - (nent - 1) * SZDIRE;   /* Top of the entry block */
+#endif
     if (res == FR_OK && --nent) {   /* Set LFN entry if needed */
         res = dir_sdi(dp, dp->dptr - nent * SZDIRE);
         if (res == FR_OK) {
@@ -2551,6 +2657,9 @@ static FRESULT dir_register (   /* FR_OK:succeeded, FR_DENIED:no free entry or t
 
 #else   /* Non LFN configuration */
     res = dir_alloc(dp, 1);     /* Allocate an entry for SFN */
+#if FF_DIR_CACHE
+    ofs = dp->dptr;
+#endif
 
 #endif
 
@@ -2564,6 +2673,9 @@ static FRESULT dir_register (   /* FR_OK:succeeded, FR_DENIED:no free entry or t
             dp->dir[DIR_NTres] = dp->fn[NSFLAG] & (NS_BODY | NS_EXT);   /* Put NT flag */
 #endif
             fs->wflag = 1;
+#if FF_DIR_CACHE
+            dir_remember(dp, dir_hash(dp), ofs);    /* The new object will most likely be opened soon */
+#endif
         }
     }
 
@@ -2588,6 +2700,10 @@ static FRESULT dir_remove ( /* FR_OK:Succeeded, FR_DISK_ERR:A disk error */
 #if FF_USE_LFN      /* LFN configuration */
     DWORD last = dp->dptr;
 
+#if FF_DIR_CACHE
+    dir_forget(dp, (dp->blk_ofs == 0xFFFFFFFF) ? dp->dptr : dp->blk_ofs);
+#endif
+
     res = (dp->blk_ofs == 0xFFFFFFFF) ? FR_OK : dir_sdi(dp, dp->blk_ofs);   /* Goto top of the entry block if LFN is exist */
     if (res == FR_OK) {
         do {
@@ -2605,7 +2721,9 @@ static FRESULT dir_remove ( /* FR_OK:Succeeded, FR_DISK_ERR:A disk error */
         if (res == FR_NO_FILE) res = FR_INT_ERR;
     }
 #else           /* Non LFN configuration */
-
+#if FF_DIR_CACHE
+    dir_forget(dp, dp->dptr);
+#endif
     res = move_window(fs, dp->sect);
     if (res == FR_OK) {
         dp->dir[DIR_Name] = DDEM;   /* Mark the entry 'deleted'.*/
@@ -3673,7 +3791,16 @@ FRESULT f_read (
             cc = btr / SS(fs);                  /* When remaining bytes >= sector size, */
             if (cc > 0) {                       /* Read maximum contiguous sectors directly */
                 if (csect + cc > fs->csize) {   /* Clip at cluster boundary */
+                    // CIRCUITPY-CHANGE: Carry on through clusters that follow on from each other on
+                    // the volume, so that a large read reaches the device as one transfer.
+                    UINT want = cc;
                     cc = fs->csize - csect;
+                    while (cc < want) {
+                        clst = get_fat(&fp->obj, fp->clust);
+                        if (clst != fp->clust + 1) break;   /* Not contiguous (or end of chain or error, handled on the next cluster boundary) */
+                        fp->clust = clst;
+                        cc += (want - cc < fs->csize) ? want - cc : fs->csize;
+                    }
                 }
                 if (disk_read(fs->drv, rbuff, sect, cc) != RES_OK) ABORT(fs, FR_DISK_ERR);
 #if !FF_FS_READONLY && FF_FS_MINIMIZE <= 2      /* Replace one of the read sectors with cached data if it contains a dirty sector */
@@ -3788,7 +3915,17 @@ FRESULT f_write (
             cc = btw / SS(fs);              /* When remaining bytes >= sector size, */
             if (cc > 0) {                   /* Write maximum contiguous sectors directly */
                 if (csect + cc > fs->csize) {   /* Clip at cluster boundary */
+                    // CIRCUITPY-CHANGE: Follow or stretch the chain as long as the next cluster is
+                    // the next one on the volume, so that a large write reaches the device as one
+                    // transfer. Newly allocated clusters usually are.
+                    UINT want = cc;
                     cc = fs->csize - csect;
+                    while (cc < want) {
+                        clst = create_chain(&fp->obj, fp->clust);
+                        if (clst != fp->clust + 1) break;   /* Not contiguous (or disk full or error, handled on the next cluster boundary) */
+                        fp->clust = clst;
+                        cc += (want - cc < fs->csize) ? want - cc : fs->csize;
+                    }
                 }
                 if (disk_write(fs->drv, wbuff, sect, cc) != RES_OK) ABORT(fs, FR_DISK_ERR);
 #if FF_FS_MINIMIZE <= 2
@@ -3917,6 +4054,35 @@ FRESULT f_sync (
     LEAVE_FF(fs, res);
 }
 
+
+
+// CIRCUITPY-CHANGE: Write the data of the file to the medium without updating its
+// directory entry. The f_sync() after it then only extends the file over sectors
+// that are already written, so the file never ends in data lost at power down.
+FRESULT f_sync_data (
+    FIL* fp     /* Pointer to the file object */
+)
+{
+    FRESULT res;
+    FATFS *fs;
+
+
+    res = validate(&fp->obj, &fs);  /* Check validity of the file object */
+    if (res == FR_OK) {
+#if FF_FS_TINY
+        res = sync_window(fs);      /* Write-back the window holding the data */
+#else
+        if (fp->flag & FA_DIRTY) {  /* Write-back cached data if needed */
+            if (disk_write(fs->drv, fp->buf, fp->sect, 1) != RES_OK) LEAVE_FF(fs, FR_DISK_ERR);
+            fp->flag &= (BYTE)~FA_DIRTY;
+        }
+#endif
+        if (res == FR_OK && disk_ioctl(fs->drv, CTRL_SYNC, 0) != RES_OK) res = FR_DISK_ERR;
+    }
+
+    LEAVE_FF(fs, res);
+}
+
 #endif /* !FF_FS_READONLY */
 
 
@@ -286,6 +286,8 @@ FRESULT f_write (FIL* fp, const void* buff, UINT btw, UINT* bw);    /* Write dat
 FRESULT f_lseek (FIL* fp, FSIZE_t ofs);                             /* Move file pointer of the file object */
 FRESULT f_truncate (FIL* fp);                                       /* Truncate the file */
 FRESULT f_sync (FIL* fp);                                           /* Flush cached data of the writing file */
+// CIRCUITPY-CHANGE
+FRESULT f_sync_data (FIL* fp);                                      /* Write data of the writing file to the medium but not its size */
 FRESULT f_opendir (FATFS *fs, FF_DIR* dp, const TCHAR* path);       /* Open a directory */
 FRESULT f_closedir (FF_DIR* dp);                                    /* Close an open directory */
 FRESULT f_readdir (FF_DIR* dp, FILINFO* fno);                       /* Read a directory item */
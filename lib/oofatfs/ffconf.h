@@ -83,6 +83,16 @@
 /* This option switches fast seek function. (0:Disable or 1:Enable) */
 
 
+// CIRCUITPY-CHANGE
+#ifdef MICROPY_FATFS_DIR_CACHE
+#define FF_DIR_CACHE    (MICROPY_FATFS_DIR_CACHE)
+#else
+#define FF_DIR_CACHE    0
+#endif
+/* Number of remembered directory entry locations, so that looking up a name that
+/  was seen before does not scan the directory from the top. (0:Disable) */
+
+
 #define FF_USE_EXPAND   0
 /* This option switches f_expand function. (0:Disable or 1:Enable) */
 
@@ -18,6 +18,19 @@
 #include "py/binary.h"
 #include "py/bc.h"
 
+#if CIRCUITPY_DISPLAYIO_UNIX
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/displayio/ColorConverter.h"
+#include "shared-bindings/displayio/CompressedBitmap.h"
+#include "shared-bindings/displayio/OnDiskBitmap.h"
+#include "shared-bindings/displayio/TileGrid.h"
+#include "shared-bindings/vectorio/Polygon.h"
+#endif
+
+#if MICROPY_VFS_FAT_LOG
+#include "extmod/vfs_fat.h"
+#endif
+
 // expected output of this file is found in extra_coverage.py.exp
 
 #if defined(MICROPY_UNIX_COVERAGE)
@@ -183,6 +196,52 @@ STATIC void pairheap_test(size_t nops, int *ops) {
 }
 
 // function to run extra tests for things that can't be checked by scripts
+#if CIRCUITPY_DISPLAYIO_UNIX
+// Read every pixel of an OnDiskBitmap with each row cache size, top down,
+// bottom up and column by column, and check the values against the uncached
+// reads. The file must be on a VfsFat.
+STATIC mp_obj_t ondiskbitmap_check_cache(mp_obj_t file_in) {
+    static const uint16_t cache_rows[] = {0, 1, 3, 1000};
+    displayio_ondiskbitmap_t *bitmaps[MP_ARRAY_SIZE(cache_rows)];
+    for (size_t i = 0; i < MP_ARRAY_SIZE(cache_rows); i++) {
+        bitmaps[i] = mp_obj_malloc(displayio_ondiskbitmap_t, &displayio_ondiskbitmap_type);
+        common_hal_displayio_ondiskbitmap_construct(bitmaps[i], MP_OBJ_TO_PTR(file_in), cache_rows[i]);
+    }
+    int width = common_hal_displayio_ondiskbitmap_get_width(bitmaps[0]);
+    int height = common_hal_displayio_ondiskbitmap_get_height(bitmaps[0]);
+    for (int order = 0; order < 3; order++) {
+        for (size_t i = 1; i < MP_ARRAY_SIZE(cache_rows); i++) {
+            bool same = true;
+            for (int n = 0; n < width * height; n++) {
+                int x = n % width;
+                int y = n / width;
+                if (order == 1) {
+                    y = height - 1 - y;
+                } else if (order == 2) {
+                    x = n / height;
+                    y = n % height;
+                }
+                same &= common_hal_displayio_ondiskbitmap_get_pixel(bitmaps[i], x, y) ==
+                    common_hal_displayio_ondiskbitmap_get_pixel(bitmaps[0], x, y);
+            }
+            mp_printf(&mp_plat_print, "ondiskbitmap order %d cache_rows %d: %d\n", order, cache_rows[i], same);
+        }
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(ondiskbitmap_check_cache_obj, ondiskbitmap_check_cache);
+#endif
+
+#if MICROPY_VFS_FAT_LOG
+// Unix has no ticks, so run the timed commit of FAT log files on demand and
+// return the count of block device calls still marked as in progress.
+STATIC mp_obj_t vfs_fat_log_run_background(void) {
+    vfs_fat_log_background();
+    return MP_OBJ_NEW_SMALL_INT(vfs_fat_disk_busy);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(vfs_fat_log_run_background_obj, vfs_fat_log_run_background);
+#endif
+
 STATIC mp_obj_t extra_coverage(void) {
     // mp_printf (used by ports that don't have a native printf)
     {
@@ -726,6 +785,131 @@ STATIC mp_obj_t extra_coverage(void) {
         mp_printf(&mp_plat_print, "%d %d\n", mp_obj_is_int(MP_OBJ_NEW_SMALL_INT(1)), mp_obj_is_int(mp_obj_new_int_from_ll(1)));
     }
 
+    #if CIRCUITPY_DISPLAYIO_UNIX
+    // displayio
+    {
+        mp_printf(&mp_plat_print, "# displayio\n");
+
+        // A TileGrid draws a CompressedBitmap exactly like the Bitmap it was
+        // made from, however the tiles are flipped and transposed.
+        displayio_bitmap_t *bitmap = mp_obj_malloc(displayio_bitmap_t, &displayio_bitmap_type);
+        common_hal_displayio_bitmap_construct(bitmap, 24, 10, 8);
+        for (int y = 0; y < 10; y++) {
+            for (int x = 0; x < 24; x++) {
+                common_hal_displayio_bitmap_set_pixel(bitmap, x, y, (x >= 5 && x < 15) ? y : (x * 7 + y * 13) & 0xff);
+            }
+        }
+        displayio_compressedbitmap_t *compressed = mp_obj_malloc(displayio_compressedbitmap_t, &displayio_compressedbitmap_type);
+        common_hal_displayio_compressedbitmap_construct(compressed, bitmap);
+        _displayio_colorspace_t colorspace = { .depth = 32 };
+        for (int flags = 0; flags < 8; flags++) {
+            uint32_t buffers[2][12 * 15 * 2];
+            for (int i = 0; i < 2; i++) {
+                displayio_tilegrid_t *tilegrid = m_new_obj(displayio_tilegrid_t);
+                common_hal_displayio_tilegrid_construct(tilegrid, i == 0 ? MP_OBJ_FROM_PTR(bitmap) : MP_OBJ_FROM_PTR(compressed),
+                    3, 2, mp_const_none, 3, 2, 8, 5, 0, 0, 0);
+                for (int t = 0; t < 6; t++) {
+                    common_hal_displayio_tilegrid_set_tile(tilegrid, t % 3, t / 3, (t * 5 + 1) % 6);
+                }
+                common_hal_displayio_tilegrid_set_flip_x(tilegrid, flags & 1);
+                common_hal_displayio_tilegrid_set_flip_y(tilegrid, flags & 2);
+                common_hal_displayio_tilegrid_set_transpose_xy(tilegrid, flags & 4);
+                displayio_tilegrid_update_transform(tilegrid, &null_transform);
+                uint32_t mask[(24 * 10 + 31) / 32] = {0};
+                memset(buffers[i], 0, sizeof(buffers[i]));
+                displayio_tilegrid_fill_area(tilegrid, &colorspace, &tilegrid->current_area, mask, buffers[i]);
+            }
+            mp_printf(&mp_plat_print, "tilegrid flags %d: %d\n", flags, memcmp(buffers[0], buffers[1], sizeof(buffers[0])) == 0);
+        }
+
+        // Span conversion matches converting one pixel at a time, and is only
+        // offered for output colorspaces where every pixel is opaque.
+        static const _displayio_colorspace_t outputs[] = {
+            { .depth = 32 },
+            { .depth = 16 },
+            { .depth = 16, .reverse_bytes_in_word = true },
+            { .depth = 8 },
+            { .depth = 8, .grayscale = true },
+            { .depth = 4 },
+            { .depth = 4, .sevencolor = true },
+            { .depth = 4, .grayscale = true, .grayscale_bit = 4 },
+            { .depth = 1, .grayscale = true, .grayscale_bit = 7 },
+            { .depth = 1, .tricolor = true, .tricolor_hue = 0 },
+            { .depth = 2, .grayscale = true, .tricolor = true, .tricolor_hue = 0, .grayscale_bit = 6 },
+            { .depth = 2 },
+            { .depth = 24, .grayscale = true },
+        };
+        uint32_t inputs[64];
+        for (size_t i = 0; i < MP_ARRAY_SIZE(inputs); i++) {
+            inputs[i] = (i % 5 == 0) ? (i & 0xf) * 0x111111 : (i * 0x9e3779b1) >> 8;
+        }
+        for (size_t o = 0; o < MP_ARRAY_SIZE(outputs); o++) {
+            bool can = true;
+            bool same = true;
+            for (int input_colorspace = DISPLAYIO_COLORSPACE_RGB888; input_colorspace <= DISPLAYIO_COLORSPACE_L8; input_colorspace++) {
+                displayio_colorconverter_t *converter = mp_obj_malloc(displayio_colorconverter_t, &displayio_colorconverter_type);
+                common_hal_displayio_colorconverter_construct(converter, false, input_colorspace);
+                can &= displayio_colorconverter_can_convert_span(converter, &outputs[o]);
+                if (!can) {
+                    break;
+                }
+                // Bitmaps only hold values as wide as the input colorspace.
+                uint32_t input_mask = input_colorspace == DISPLAYIO_COLORSPACE_RGB888 ? 0xffffff : 0xffff;
+                uint32_t span[MP_ARRAY_SIZE(inputs)];
+                for (size_t i = 0; i < MP_ARRAY_SIZE(inputs); i++) {
+                    span[i] = inputs[i] & input_mask;
+                }
+                displayio_colorconverter_convert_span(converter, &outputs[o], span, MP_ARRAY_SIZE(span));
+                for (size_t i = 0; i < MP_ARRAY_SIZE(inputs); i++) {
+                    displayio_input_pixel_t input_pixel = { .pixel = inputs[i] & input_mask };
+                    displayio_output_pixel_t output_pixel = { .pixel = 0, .opaque = true };
+                    displayio_colorconverter_convert(converter, &outputs[o], &input_pixel, &output_pixel);
+                    same &= output_pixel.opaque && output_pixel.pixel == span[i];
+                }
+            }
+            mp_printf(&mp_plat_print, "colorconverter span %d: %d %d\n", (int)o, can, can && same);
+        }
+
+        // Polygon spans cover exactly the pixels get_pixel reports, for convex,
+        // concave and self-intersecting outlines. Each shape is a point count
+        // followed by that many x, y pairs.
+        static const int16_t shapes[][13] = {
+            { 3, 0, 1, 0, 8, 5, 0 },
+            { 4, 0, 0, 17, 0, 17, 17, 0, 17 },
+            { 6, 0, 0, 16, 0, 16, 16, 8, 4, 0, 16, 0, 0 },
+            { 4, 1, 1, 19, 14, 1, 14, 19, 1 },
+            { 5, 10, 0, 16, 19, 0, 7, 20, 7, 4, 19 },
+            { 5, 1, 1, 18, 3, 2, 18, 17, 16, 9, 2 },
+        };
+        for (size_t p = 0; p < MP_ARRAY_SIZE(shapes); p++) {
+            mp_obj_t points = mp_obj_new_list(0, NULL);
+            for (int i = 0; i < shapes[p][0]; i++) {
+                mp_obj_t point[] = { MP_OBJ_NEW_SMALL_INT(shapes[p][1 + 2 * i]), MP_OBJ_NEW_SMALL_INT(shapes[p][2 + 2 * i]) };
+                mp_obj_list_append(points, mp_obj_new_tuple(2, point));
+            }
+            vectorio_polygon_t *polygon = m_new_obj(vectorio_polygon_t);
+            common_hal_vectorio_polygon_construct(polygon, points, 0);
+            bool same = true;
+            int covered = 0;
+            for (int y = -2; y < 24; y++) {
+                vectorio_span_t spans[8];
+                uint16_t span_count = common_hal_vectorio_polygon_get_spans(polygon, y, -2, 24, spans, MP_ARRAY_SIZE(spans));
+                uint16_t s = 0;
+                for (int x = -2; x < 24; x++) {
+                    while (s < span_count && spans[s].x2 <= x) {
+                        s++;
+                    }
+                    bool in_span = s < span_count && spans[s].x1 <= x;
+                    bool in_polygon = common_hal_vectorio_polygon_get_pixel(polygon, x, y) != 0;
+                    same &= in_span == in_polygon;
+                    covered += in_polygon;
+                }
+            }
+            mp_printf(&mp_plat_print, "polygon %d: %d %d\n", (int)p, covered, same);
+        }
+    }
+    #endif
+
     mp_printf(&mp_plat_print, "# end coverage.c\n");
 
     mp_obj_streamtest_t *s = mp_obj_malloc(mp_obj_streamtest_t, &mp_type_stest_fileio);
@@ -736,7 +920,14 @@ STATIC mp_obj_t extra_coverage(void) {
     mp_obj_streamtest_t *s2 = mp_obj_malloc(mp_obj_streamtest_t, &mp_type_stest_textio2);
 
     // return a tuple of data for testing on the Python side
-    mp_obj_t items[] = {(mp_obj_t)&str_no_hash_obj, (mp_obj_t)&bytes_no_hash_obj, MP_OBJ_FROM_PTR(s), MP_OBJ_FROM_PTR(s2)};
+    mp_obj_t items[] = {(mp_obj_t)&str_no_hash_obj, (mp_obj_t)&bytes_no_hash_obj, MP_OBJ_FROM_PTR(s), MP_OBJ_FROM_PTR(s2),
+                        #if CIRCUITPY_DISPLAYIO_UNIX
+                        MP_OBJ_FROM_PTR(&ondiskbitmap_check_cache_obj),
+                        #endif
+                        #if MICROPY_VFS_FAT_LOG
+                        MP_OBJ_FROM_PTR(&vfs_fat_log_run_background_obj),
+                        #endif
+    };
     return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
 }
 MP_DEFINE_CONST_FUN_OBJ_0(extra_coverage_obj, extra_coverage);
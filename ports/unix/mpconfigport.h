@@ -150,6 +150,10 @@ typedef long mp_off_t;
 #define MICROPY_FATFS_LFN_CODE_PAGE    437 /* 1=SFN/ANSI 437=LFN/U.S.(OEM) */
 #define MICROPY_FATFS_MKFS_FAT32       (1)
 #define MICROPY_FATFS_USE_LABEL (1)
+// CIRCUITPY-CHANGE
+#define MICROPY_FATFS_CACHE_SECTORS    (8)
+#define MICROPY_FATFS_DIR_CACHE        (64)
+#define MICROPY_VFS_FAT_LOG            (1)
 
 #define MICROPY_ALLOC_PATH_MAX      (PATH_MAX)
 
@@ -42,6 +42,10 @@
 #define MICROPY_TRACKED_ALLOC          (1)
 #define MICROPY_WARNINGS_CATEGORY      (1)
 
+// CIRCUITPY-CHANGE: Unix doesn't include circuitpy_mpconfig.h, so size the
+// os.getenv() key index here so that it is built and tested.
+#define CIRCUITPY_OS_GETENV_INDEX_SIZE (48)
+
 // CIRCUITPY-CHANGE: Disable things never used in circuitpython
 #define MICROPY_PY_CRYPTOLIB          (0)
 #define MICROPY_PY_CRYPTOLIB_CTR      (0)
@@ -31,16 +31,26 @@ SRC_BITMAP := \
 	shared-bindings/audiocore/__init__.c \
 	shared-bindings/audiocore/RawSample.c \
 	shared-bindings/audiocore/WaveFile.c \
+	shared-bindings/audioeffects/__init__.c \
+	shared-bindings/audioeffects/Chorus.c \
+	shared-bindings/audioeffects/Delay.c \
+	shared-bindings/audioeffects/Reverb.c \
 	shared-bindings/audiomixer/__init__.c \
 	shared-bindings/audiomixer/Mixer.c \
 	shared-bindings/audiomixer/MixerVoice.c \
 	shared-bindings/bitmaptools/__init__.c \
 	shared-bindings/codeop/__init__.c \
 	shared-bindings/displayio/Bitmap.c \
+	shared-bindings/displayio/ColorConverter.c \
+	shared-bindings/displayio/CompressedBitmap.c \
+	shared-bindings/displayio/OnDiskBitmap.c \
+	shared-bindings/displayio/Palette.c \
 	shared-bindings/jpegio/__init__.c \
 	shared-bindings/jpegio/JpegDecoder.c \
 	shared-bindings/locale/__init__.c \
 	shared-bindings/rainbowio/__init__.c \
+	shared-bindings/spectrum/__init__.c \
+	shared-bindings/spectrum/FFT.c \
 	shared-bindings/struct/__init__.c \
 	shared-bindings/synthio/__init__.c \
 	shared-bindings/synthio/Math.c \
@@ -48,6 +58,7 @@ SRC_BITMAP := \
 	shared-bindings/synthio/LFO.c \
 	shared-bindings/synthio/Note.c \
 	shared-bindings/synthio/Biquad.c \
+	shared-bindings/synthio/BlockBiquad.c \
 	shared-bindings/synthio/Synthesizer.c \
 	shared-bindings/traceback/__init__.c \
 	shared-bindings/util.c \
@@ -57,6 +68,10 @@ SRC_BITMAP := \
 	shared-module/audiocore/__init__.c \
 	shared-module/audiocore/RawSample.c \
 	shared-module/audiocore/WaveFile.c \
+	shared-module/audioeffects/__init__.c \
+	shared-module/audioeffects/Chorus.c \
+	shared-module/audioeffects/Delay.c \
+	shared-module/audioeffects/Reverb.c \
 	shared-module/audiomixer/__init__.c \
 	shared-module/audiomixer/Mixer.c \
 	shared-module/audiomixer/MixerVoice.c \
@@ -64,11 +79,15 @@ SRC_BITMAP := \
 	shared-module/displayio/area.c \
 	shared-module/displayio/Bitmap.c \
 	shared-module/displayio/ColorConverter.c \
-	shared-module/displayio/ColorConverter.c \
+	shared-module/displayio/CompressedBitmap.c \
+	shared-module/displayio/OnDiskBitmap.c \
+	shared-module/displayio/Palette.c \
+	shared-module/displayio/TileGrid.c \
 	shared-module/jpegio/__init__.c \
 	shared-module/jpegio/JpegDecoder.c \
 	shared-module/os/getenv.c \
 	shared-module/rainbowio/__init__.c \
+	shared-module/spectrum/FFT.c \
 	shared-module/struct/__init__.c \
 	shared-module/synthio/__init__.c \
 	shared-module/synthio/Math.c \
@@ -76,8 +95,10 @@ SRC_BITMAP := \
 	shared-module/synthio/LFO.c \
 	shared-module/synthio/Note.c \
 	shared-module/synthio/Biquad.c \
+	shared-module/synthio/BlockBiquad.c \
 	shared-module/synthio/Synthesizer.c \
 	shared-module/traceback/__init__.c \
+	shared-module/vectorio/Polygon.c \
 	shared-module/zlib/__init__.c \
 
 SRC_C += $(SRC_BITMAP)
@@ -85,6 +106,7 @@ SRC_C += $(SRC_BITMAP)
 CFLAGS += \
 	-DCIRCUITPY_AESIO=1 \
 	-DCIRCUITPY_AUDIOCORE=1 \
+	-DCIRCUITPY_AUDIOEFFECTS=1 \
 	-DCIRCUITPY_AUDIOMIXER=1 \
 	-DCIRCUITPY_AUDIOCORE_DEBUG=1 \
 	-DCIRCUITPY_BITMAPTOOLS=1 \
@@ -96,6 +118,7 @@ CFLAGS += \
 	-DCIRCUITPY_LOCALE=1 \
 	-DCIRCUITPY_OS_GETENV=1 \
 	-DCIRCUITPY_RAINBOWIO=1 \
+	-DCIRCUITPY_SPECTRUM=1 \
 	-DCIRCUITPY_STRUCT=1 \
 	-DCIRCUITPY_SYNTHIO=1 \
 	-DCIRCUITPY_SYNTHIO_MAX_CHANNELS=14 \
@@ -179,6 +179,24 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_FATFS_MULTI_PARTITION (1)
 #define MICROPY_FATFS_LFN_UNICODE      2  // UTF-8
 
+// Sector cache for each VfsFat created from Python, such as on an SD card. The
+// CIRCUITPY drive is not cached this way because its flash layer has a cache.
+#ifndef MICROPY_FATFS_CACHE_SECTORS
+#define MICROPY_FATFS_CACHE_SECTORS (CIRCUITPY_FULL_BUILD ? 8 : 0)
+#endif
+
+// Number of remembered directory entry locations (20 bytes each), shared by all
+// FAT volumes, so that opening a file in a large directory does not rescan it.
+#ifndef MICROPY_FATFS_DIR_CACHE
+#define MICROPY_FATFS_DIR_CACHE (CIRCUITPY_FULL_BUILD ? 32 : 0)
+#endif
+
+// open(path, "a", buffering=n) on a FAT volume returns a log file that commits
+// records in batches. See extmod/vfs_fat.h.
+#ifndef MICROPY_VFS_FAT_LOG
+#define MICROPY_VFS_FAT_LOG (CIRCUITPY_FULL_BUILD)
+#endif
+
 // Only enable this if you really need it. It allocates a byte cache of this size.
 // #define MICROPY_FATFS_MAX_SS           (4096)
 
@@ -360,6 +378,12 @@ typedef long mp_off_t;
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (0)
 #endif
 
+// Number of settings.toml keys os.getenv() can find without rescanning the
+// file. Each entry costs 4 bytes of RAM.
+#ifndef CIRCUITPY_OS_GETENV_INDEX_SIZE
+#define CIRCUITPY_OS_GETENV_INDEX_SIZE (CIRCUITPY_FULL_BUILD ? 48 : 0)
+#endif
+
 // This is not a top-level module; it's microcontroller.nvm.
 #if CIRCUITPY_NVM
 extern const struct _mp_obj_module_t nvm_module;
@@ -431,6 +455,13 @@ void background_callback_run_all(void);
 #define CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS 1000
 #endif
 
+// Erase sectors of an external flash CIRCUITPY drive that are cached in RAM
+// while they are written, 4 kB each. Blocks written to any of them don't cost
+// an erase until the cache is flushed or the sector is evicted.
+#ifndef CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS
+#define CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS (CIRCUITPY_FULL_BUILD ? 4 : 1)
+#endif
+
 #ifndef CIRCUITPY_PYSTACK_SIZE
 #define CIRCUITPY_PYSTACK_SIZE 1536
 #endif
@@ -997,6 +997,16 @@ typedef double mp_float_t;
 #define MICROPY_VFS_POSIX (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Support for mapping VfsPosix files into memory with file.mmap()
+#ifndef MICROPY_VFS_POSIX_MMAP
+#ifdef _WIN32
+#define MICROPY_VFS_POSIX_MMAP (0)
+#else
+#define MICROPY_VFS_POSIX_MMAP (MICROPY_VFS_POSIX)
+#endif
+#endif
+
 // Support for VFS FAT component, to mount a FAT filesystem within VFS
 #ifndef MICROPY_VFS_FAT
 #define MICROPY_VFS_FAT (0)
@@ -94,10 +94,83 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(audiocore_reset_buffer_obj, audiocore_reset_buf
 
 #endif
 
+//| def render(
+//|     sample: circuitpython_typing.AudioSample,
+//|     buffer: Union[WriteableBuffer, circuitpython_typing.ByteStream],
+//|     *,
+//|     length: int = -1,
+//|     reset: bool = False,
+//| ) -> Tuple[int, bool]:
+//|     """Pull audio from ``sample`` as fast as possible instead of in real time.
+//|
+//|     Samples are written exactly as an audio output would receive them: interleaved
+//|     when there are two channels, with the sample's own `bits_per_sample` and signedness.
+//|
+//|     If ``buffer`` is a writable buffer, whole blocks are copied into it until the sample
+//|     ends or the next block might not fit, so consecutive calls lose nothing. The buffer
+//|     must be at least as large as the sample's largest block.
+//|
+//|     Otherwise ``buffer`` must have a ``write`` method, such as a file opened for binary
+//|     writing. Each block is passed to it in turn until the sample ends or ``length`` bytes
+//|     have been written. The view passed to ``write`` is only valid until it returns.
+//|     The part of the last block beyond ``length`` is discarded, so to render a sample in
+//|     pieces without losing any of it, use a writable buffer instead.
+//|
+//|     Background tasks run between blocks, so samples that decode ahead in the background,
+//|     such as `audiomp3.MP3Decoder`, keep doing so, and Ctrl-C interrupts a long render.
+//|
+//|     :param int length: The maximum number of bytes to write. Required for samples that
+//|       never end, such as `synthio.Synthesizer`, when writing to a stream. It is rounded
+//|       down to a whole number of frames, so a 16-bit sample is never split.
+//|     :param bool reset: Start the sample from the beginning first. A `audiocore.WaveFile`
+//|       needs this before its first render. Resetting an `audiomixer.Mixer` stops its voices.
+//|
+//|     Returns the number of bytes written and whether the sample ended."""
+//|     ...
+//|
+STATIC mp_obj_t audiocore_render(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_buffer, ARG_length, ARG_reset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_length, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_reset, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t sample = args[ARG_sample].u_obj;
+    mp_obj_t buffer = args[ARG_buffer].u_obj;
+    mp_int_t length = args[ARG_length].u_int;
+    // Checks that sample really is an audio sample.
+    mp_proto_get_or_throw(MP_QSTR_protocol_audiosample, sample);
+
+    if (args[ARG_reset].u_bool) {
+        audiosample_reset_buffer(sample, false, 0);
+    }
+
+    bool done;
+    uint32_t written;
+    mp_buffer_info_t bufinfo;
+    if (mp_get_buffer(buffer, &bufinfo, MP_BUFFER_WRITE)) {
+        if (length >= 0 && (size_t)length < bufinfo.len) {
+            bufinfo.len = length;
+        }
+        written = audiosample_render_into(sample, bufinfo.buf, bufinfo.len, &done);
+    } else {
+        written = audiosample_render_to_writer(sample, buffer, length < 0 ? UINT32_MAX : (uint32_t)length, &done);
+    }
+
+    mp_obj_t result[2] = {mp_obj_new_int_from_uint(written), mp_obj_new_bool(done)};
+    return mp_obj_new_tuple(2, result);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(audiocore_render_obj, 2, audiocore_render);
+
 STATIC const mp_rom_map_elem_t audiocore_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audiocore) },
     { MP_ROM_QSTR(MP_QSTR_RawSample), MP_ROM_PTR(&audioio_rawsample_type) },
     { MP_ROM_QSTR(MP_QSTR_WaveFile), MP_ROM_PTR(&audioio_wavefile_type) },
+    { MP_ROM_QSTR(MP_QSTR_render), MP_ROM_PTR(&audiocore_render_obj) },
     #if CIRCUITPY_AUDIOCORE_DEBUG
     { MP_ROM_QSTR(MP_QSTR_get_buffer), MP_ROM_PTR(&audiocore_get_buffer_obj) },
     { MP_ROM_QSTR(MP_QSTR_reset_buffer), MP_ROM_PTR(&audiocore_reset_buffer_obj) },
@@ -0,0 +1,202 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <stdint.h>
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared/runtime/context_manager_helpers.h"
+#include "shared-bindings/audioeffects/__init__.h"
+#include "shared-bindings/audioeffects/Delay.h"
+#include "shared-bindings/util.h"
+
+//| class Delay:
+//|     """Repeats its source after a delay, with feedback for repeating echoes"""
+//|
+//|     def __init__(
+//|         self,
+//|         source: circuitpython_typing.AudioSample,
+//|         *,
+//|         delay_ms: float = 250.0,
+//|         max_delay_ms: float = 500.0,
+//|         feedback: float = 0.5,
+//|         mix: float = 0.5,
+//|     ) -> None:
+//|         """Create a delay that processes ``source``.
+//|
+//|         :param ~circuitpython_typing.AudioSample source: The sample to process
+//|         :param float delay_ms: The time between the input and its first echo, up to ``max_delay_ms``
+//|         :param float max_delay_ms: The longest delay that will be used. The delay line's
+//|           memory is allocated for this length up front.
+//|         :param float feedback: How much of each echo is fed back into the delay, from 0 to 1
+//|         :param float mix: The balance between the original (0) and the delayed (1) signal
+//|         """
+//|         ...
+STATIC mp_obj_t audioeffects_delay_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_source, ARG_delay_ms, ARG_max_delay_ms, ARG_feedback, ARG_mix };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_source, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_delay_ms, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_max_delay_ms, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_feedback, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_mix, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t source = args[ARG_source].u_obj;
+    mp_proto_get_or_throw(MP_QSTR_protocol_audiosample, source);
+    mp_float_t delay_ms = audioeffects_validate_float(args[ARG_delay_ms].u_obj, MICROPY_FLOAT_CONST(250.0), 0, 5000, MP_QSTR_delay_ms);
+    mp_float_t max_delay_ms = audioeffects_validate_float(args[ARG_max_delay_ms].u_obj, MICROPY_FLOAT_CONST(500.0), 1, 5000, MP_QSTR_max_delay_ms);
+    mp_float_t feedback = audioeffects_validate_float(args[ARG_feedback].u_obj, MICROPY_FLOAT_CONST(0.5), 0, 1, MP_QSTR_feedback);
+    mp_float_t mix = audioeffects_validate_float(args[ARG_mix].u_obj, MICROPY_FLOAT_CONST(0.5), 0, 1, MP_QSTR_mix);
+    audioeffects_validate_delay(delay_ms, max_delay_ms, MP_QSTR_delay_ms);
+
+    audioeffects_delay_obj_t *self = mp_obj_malloc(audioeffects_delay_obj_t, &audioeffects_delay_type);
+    common_hal_audioeffects_delay_construct(self, source, delay_ms, max_delay_ms, feedback, mix);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Delay and releases its memory."""
+//|         ...
+STATIC mp_obj_t audioeffects_delay_deinit(mp_obj_t self_in) {
+    audioeffects_delay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audioeffects_delay_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(audioeffects_delay_deinit_obj, audioeffects_delay_deinit);
+
+STATIC void check_for_deinit(audioeffects_delay_obj_t *self) {
+    if (common_hal_audioeffects_delay_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def __enter__(self) -> Delay:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+STATIC mp_obj_t audioeffects_delay_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audioeffects_delay_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audioeffects_delay___exit___obj, 4, 4, audioeffects_delay_obj___exit__);
+
+//|     delay_ms: float
+//|     """The delay in milliseconds. It must be at most the ``max_delay_ms`` given when constructed."""
+STATIC mp_obj_t audioeffects_delay_obj_get_delay_ms(mp_obj_t self_in) {
+    audioeffects_delay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audioeffects_delay_get_delay_ms(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioeffects_delay_get_delay_ms_obj, audioeffects_delay_obj_get_delay_ms);
+
+STATIC mp_obj_t audioeffects_delay_obj_set_delay_ms(mp_obj_t self_in, mp_obj_t delay_ms_in) {
+    audioeffects_delay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_float_t delay_ms = mp_arg_validate_obj_float_range(delay_ms_in, 0, 5000, MP_QSTR_delay_ms);
+    audioeffects_validate_delay(delay_ms, common_hal_audioeffects_delay_get_max_delay_ms(self), MP_QSTR_delay_ms);
+    common_hal_audioeffects_delay_set_delay_ms(self, delay_ms);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audioeffects_delay_set_delay_ms_obj, audioeffects_delay_obj_set_delay_ms);
+
+MP_PROPERTY_GETSET(audioeffects_delay_delay_ms_obj,
+    (mp_obj_t)&audioeffects_delay_get_delay_ms_obj,
+    (mp_obj_t)&audioeffects_delay_set_delay_ms_obj);
+
+//|     feedback: float
+//|     """How much of each echo is fed back into the delay, from 0 to 1"""
+STATIC mp_obj_t audioeffects_delay_obj_get_feedback(mp_obj_t self_in) {
+    audioeffects_delay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audioeffects_delay_get_feedback(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioeffects_delay_get_feedback_obj, audioeffects_delay_obj_get_feedback);
+
+STATIC mp_obj_t audioeffects_delay_obj_set_feedback(mp_obj_t self_in, mp_obj_t feedback_in) {
+    audioeffects_delay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audioeffects_delay_set_feedback(self, mp_arg_validate_obj_float_range(feedback_in, 0, 1, MP_QSTR_feedback));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audioeffects_delay_set_feedback_obj, audioeffects_delay_obj_set_feedback);
+
+MP_PROPERTY_GETSET(audioeffects_delay_feedback_obj,
+    (mp_obj_t)&audioeffects_delay_get_feedback_obj,
+    (mp_obj_t)&audioeffects_delay_set_feedback_obj);
+
+//|     mix: float
+//|     """The balance between the original (0) and the delayed (1) signal"""
+//|
+STATIC mp_obj_t audioeffects_delay_obj_get_mix(mp_obj_t self_in) {
+    audioeffects_delay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audioeffects_delay_get_mix(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioeffects_delay_get_mix_obj, audioeffects_delay_obj_get_mix);
+
+STATIC mp_obj_t audioeffects_delay_obj_set_mix(mp_obj_t self_in, mp_obj_t mix_in) {
+    audioeffects_delay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audioeffects_delay_set_mix(self, mp_arg_validate_obj_float_range(mix_in, 0, 1, MP_QSTR_mix));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audioeffects_delay_set_mix_obj, audioeffects_delay_obj_set_mix);
+
+MP_PROPERTY_GETSET(audioeffects_delay_mix_obj,
+    (mp_obj_t)&audioeffects_delay_get_mix_obj,
+    (mp_obj_t)&audioeffects_delay_set_mix_obj);
+
+STATIC const mp_rom_map_elem_t audioeffects_delay_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioeffects_delay_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audioeffects_delay___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_delay_ms), MP_ROM_PTR(&audioeffects_delay_delay_ms_obj) },
+    { MP_ROM_QSTR(MP_QSTR_feedback), MP_ROM_PTR(&audioeffects_delay_feedback_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mix), MP_ROM_PTR(&audioeffects_delay_mix_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audioeffects_delay_locals_dict, audioeffects_delay_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audioeffects_delay_type,
+    MP_QSTR_Delay,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audioeffects_delay_make_new,
+    locals_dict, &audioeffects_delay_locals_dict,
+    protocol, &audioeffects_effect_proto
+    );
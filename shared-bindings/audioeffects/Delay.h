@@ -0,0 +1,47 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "shared-module/audioeffects/Delay.h"
+
+extern const mp_obj_type_t audioeffects_delay_type;
+
+void common_hal_audioeffects_delay_construct(audioeffects_delay_obj_t *self, mp_obj_t source,
+    mp_float_t delay_ms, mp_float_t max_delay_ms, mp_float_t feedback, mp_float_t mix);
+void common_hal_audioeffects_delay_deinit(audioeffects_delay_obj_t *self);
+bool common_hal_audioeffects_delay_deinited(audioeffects_delay_obj_t *self);
+
+mp_float_t common_hal_audioeffects_delay_get_delay_ms(audioeffects_delay_obj_t *self);
+mp_float_t common_hal_audioeffects_delay_get_max_delay_ms(audioeffects_delay_obj_t *self);
+void common_hal_audioeffects_delay_set_delay_ms(audioeffects_delay_obj_t *self, mp_float_t delay_ms);
+
+mp_float_t common_hal_audioeffects_delay_get_feedback(audioeffects_delay_obj_t *self);
+void common_hal_audioeffects_delay_set_feedback(audioeffects_delay_obj_t *self, mp_float_t feedback);
+
+mp_float_t common_hal_audioeffects_delay_get_mix(audioeffects_delay_obj_t *self);
+void common_hal_audioeffects_delay_set_mix(audioeffects_delay_obj_t *self, mp_float_t mix);
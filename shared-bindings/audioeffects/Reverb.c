@@ -0,0 +1,198 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <stdint.h>
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared/runtime/context_manager_helpers.h"
+#include "shared-bindings/audioeffects/__init__.h"
+#include "shared-bindings/audioeffects/Reverb.h"
+#include "shared-bindings/util.h"
+
+//| class Reverb:
+//|     """Simulates the reflections of a room"""
+//|
+//|     def __init__(
+//|         self,
+//|         source: circuitpython_typing.AudioSample,
+//|         *,
+//|         room_size: float = 0.5,
+//|         damping: float = 0.5,
+//|         mix: float = 0.3,
+//|     ) -> None:
+//|         """Create a reverb that processes ``source``.
+//|
+//|         The reverb is mono. For a stereo source, the channels are summed before the
+//|         reverb and its output is added to both. It uses about 12kB of memory
+//|         at 44.1kHz, in proportion to the sample rate.
+//|
+//|         :param ~circuitpython_typing.AudioSample source: The sample to process
+//|         :param float room_size: How long the reverb lasts, from 0 to 1
+//|         :param float damping: How quickly high frequencies die away, from 0 to 1
+//|         :param float mix: The balance between the original (0) and the reverberated (1) signal
+//|         """
+//|         ...
+STATIC mp_obj_t audioeffects_reverb_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_source, ARG_room_size, ARG_damping, ARG_mix };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_source, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_room_size, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_damping, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_mix, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t source = args[ARG_source].u_obj;
+    mp_proto_get_or_throw(MP_QSTR_protocol_audiosample, source);
+    mp_float_t room_size = audioeffects_validate_float(args[ARG_room_size].u_obj, MICROPY_FLOAT_CONST(0.5), 0, 1, MP_QSTR_room_size);
+    mp_float_t damping = audioeffects_validate_float(args[ARG_damping].u_obj, MICROPY_FLOAT_CONST(0.5), 0, 1, MP_QSTR_damping);
+    mp_float_t mix = audioeffects_validate_float(args[ARG_mix].u_obj, MICROPY_FLOAT_CONST(0.3), 0, 1, MP_QSTR_mix);
+
+    audioeffects_reverb_obj_t *self = mp_obj_malloc(audioeffects_reverb_obj_t, &audioeffects_reverb_type);
+    common_hal_audioeffects_reverb_construct(self, source, room_size, damping, mix);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Reverb and releases its memory."""
+//|         ...
+STATIC mp_obj_t audioeffects_reverb_deinit(mp_obj_t self_in) {
+    audioeffects_reverb_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audioeffects_reverb_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(audioeffects_reverb_deinit_obj, audioeffects_reverb_deinit);
+
+STATIC void check_for_deinit(audioeffects_reverb_obj_t *self) {
+    if (common_hal_audioeffects_reverb_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def __enter__(self) -> Reverb:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+STATIC mp_obj_t audioeffects_reverb_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audioeffects_reverb_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audioeffects_reverb___exit___obj, 4, 4, audioeffects_reverb_obj___exit__);
+
+//|     room_size: float
+//|     """How long the reverb lasts, from 0 to 1"""
+STATIC mp_obj_t audioeffects_reverb_obj_get_room_size(mp_obj_t self_in) {
+    audioeffects_reverb_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audioeffects_reverb_get_room_size(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioeffects_reverb_get_room_size_obj, audioeffects_reverb_obj_get_room_size);
+
+STATIC mp_obj_t audioeffects_reverb_obj_set_room_size(mp_obj_t self_in, mp_obj_t room_size_in) {
+    audioeffects_reverb_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audioeffects_reverb_set_room_size(self, mp_arg_validate_obj_float_range(room_size_in, 0, 1, MP_QSTR_room_size));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audioeffects_reverb_set_room_size_obj, audioeffects_reverb_obj_set_room_size);
+
+MP_PROPERTY_GETSET(audioeffects_reverb_room_size_obj,
+    (mp_obj_t)&audioeffects_reverb_get_room_size_obj,
+    (mp_obj_t)&audioeffects_reverb_set_room_size_obj);
+
+//|     damping: float
+//|     """How quickly high frequencies die away, from 0 to 1"""
+STATIC mp_obj_t audioeffects_reverb_obj_get_damping(mp_obj_t self_in) {
+    audioeffects_reverb_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audioeffects_reverb_get_damping(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioeffects_reverb_get_damping_obj, audioeffects_reverb_obj_get_damping);
+
+STATIC mp_obj_t audioeffects_reverb_obj_set_damping(mp_obj_t self_in, mp_obj_t damping_in) {
+    audioeffects_reverb_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audioeffects_reverb_set_damping(self, mp_arg_validate_obj_float_range(damping_in, 0, 1, MP_QSTR_damping));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audioeffects_reverb_set_damping_obj, audioeffects_reverb_obj_set_damping);
+
+MP_PROPERTY_GETSET(audioeffects_reverb_damping_obj,
+    (mp_obj_t)&audioeffects_reverb_get_damping_obj,
+    (mp_obj_t)&audioeffects_reverb_set_damping_obj);
+
+//|     mix: float
+//|     """The balance between the original (0) and the reverberated (1) signal"""
+//|
+STATIC mp_obj_t audioeffects_reverb_obj_get_mix(mp_obj_t self_in) {
+    audioeffects_reverb_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audioeffects_reverb_get_mix(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioeffects_reverb_get_mix_obj, audioeffects_reverb_obj_get_mix);
+
+STATIC mp_obj_t audioeffects_reverb_obj_set_mix(mp_obj_t self_in, mp_obj_t mix_in) {
+    audioeffects_reverb_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audioeffects_reverb_set_mix(self, mp_arg_validate_obj_float_range(mix_in, 0, 1, MP_QSTR_mix));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audioeffects_reverb_set_mix_obj, audioeffects_reverb_obj_set_mix);
+
+MP_PROPERTY_GETSET(audioeffects_reverb_mix_obj,
+    (mp_obj_t)&audioeffects_reverb_get_mix_obj,
+    (mp_obj_t)&audioeffects_reverb_set_mix_obj);
+
+STATIC const mp_rom_map_elem_t audioeffects_reverb_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioeffects_reverb_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audioeffects_reverb___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_room_size), MP_ROM_PTR(&audioeffects_reverb_room_size_obj) },
+    { MP_ROM_QSTR(MP_QSTR_damping), MP_ROM_PTR(&audioeffects_reverb_damping_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mix), MP_ROM_PTR(&audioeffects_reverb_mix_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audioeffects_reverb_locals_dict, audioeffects_reverb_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audioeffects_reverb_type,
+    MP_QSTR_Reverb,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audioeffects_reverb_make_new,
+    locals_dict, &audioeffects_reverb_locals_dict,
+    protocol, &audioeffects_effect_proto
+    );
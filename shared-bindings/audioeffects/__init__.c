@@ -0,0 +1,102 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/audioeffects/__init__.h"
+#include "shared-bindings/audioeffects/Chorus.h"
+#include "shared-bindings/audioeffects/Delay.h"
+#include "shared-bindings/audioeffects/Reverb.h"
+#include "shared-module/audioeffects/__init__.h"
+
+//| """Audio effects that process another audio sample
+//|
+//| Each effect wraps a source such as `audiocore.WaveFile`, `audiomixer.Mixer` or
+//| `synthio.Synthesizer` and is itself an audio sample, so it can be played
+//| directly or passed to another effect or a mixer voice. Processing is done in
+//| blocks in fixed point as the output requests samples.
+//|
+//| Effects always output signed 16 bit samples with the source's sample rate and
+//| channel count. When their source stops, they keep playing until the echoes or
+//| reverberation still held in the effect have died away.
+//|
+//| For example, to add an echo to a wave file::
+//|
+//|     import audiocore
+//|     import audioeffects
+//|     import audioio
+//|     import board
+//|
+//|     wav = audiocore.WaveFile("drum.wav")
+//|     echo = audioeffects.Delay(wav, delay_ms=300, feedback=0.4)
+//|     a = audioio.AudioOut(board.A0)
+//|     a.play(echo)
+//| """
+
+const audiosample_p_t audioeffects_effect_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .sample_rate = (audiosample_sample_rate_fun)audioeffects_effect_get_sample_rate,
+    .bits_per_sample = (audiosample_bits_per_sample_fun)audioeffects_effect_get_bits_per_sample,
+    .channel_count = (audiosample_channel_count_fun)audioeffects_effect_get_channel_count,
+    .reset_buffer = (audiosample_reset_buffer_fun)audioeffects_effect_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audioeffects_effect_get_buffer,
+    .get_buffer_structure = (audiosample_get_buffer_structure_fun)audioeffects_effect_get_buffer_structure,
+};
+
+mp_float_t audioeffects_validate_float(mp_obj_t obj, mp_float_t default_value, mp_int_t min, mp_int_t max, qstr arg_name) {
+    if (obj == MP_OBJ_NULL) {
+        return default_value;
+    }
+    return mp_arg_validate_obj_float_range(obj, min, max, arg_name);
+}
+
+mp_float_t audioeffects_validate_delay(mp_float_t delay_ms, mp_float_t max_delay_ms, qstr arg_name) {
+    // Compare as floats, as max_delay_ms need not be a whole number.
+    if (delay_ms > max_delay_ms) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be <= %q"), arg_name, MP_QSTR_max_delay_ms);
+    }
+    return delay_ms;
+}
+
+STATIC const mp_rom_map_elem_t audioeffects_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audioeffects) },
+    { MP_ROM_QSTR(MP_QSTR_Chorus), MP_ROM_PTR(&audioeffects_chorus_type) },
+    { MP_ROM_QSTR(MP_QSTR_Delay), MP_ROM_PTR(&audioeffects_delay_type) },
+    { MP_ROM_QSTR(MP_QSTR_Reverb), MP_ROM_PTR(&audioeffects_reverb_type) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(audioeffects_module_globals, audioeffects_module_globals_table);
+
+const mp_obj_module_t audioeffects_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&audioeffects_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_audioeffects, audioeffects_module);
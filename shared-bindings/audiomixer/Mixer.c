@@ -47,15 +47,16 @@
 //|         samples_signed: bool = True,
 //|         sample_rate: int = 8000,
 //|     ) -> None:
-//|         """Create a Mixer object that can mix multiple channels with the same sample rate.
+//|         """Create a Mixer object that can mix multiple channels into a single output.
 //|         Samples are accessed and controlled with the mixer's `audiomixer.MixerVoice` objects.
 //|
 //|         :param int voice_count: The maximum number of voices to mix
 //|         :param int buffer_size: The total size in bytes of the buffers to mix into
-//|         :param int channel_count: The number of channels the source samples contain. 1 = mono; 2 = stereo.
-//|         :param int bits_per_sample: The bits per sample of the samples being played
-//|         :param bool samples_signed: Samples are signed (True) or unsigned (False)
-//|         :param int sample_rate: The sample rate to be used for all samples
+//|         :param int channel_count: The number of channels the mixer outputs. 1 = mono; 2 = stereo.
+//|         :param int bits_per_sample: The bits per sample of the mixer's output
+//|         :param bool samples_signed: Output samples are signed (True) or unsigned (False)
+//|         :param int sample_rate: The sample rate of the mixer's output. Samples with a
+//|           different rate are resampled as they are mixed.
 //|
 //|         Playing a wave file from flash::
 //|
@@ -196,7 +197,8 @@ MP_PROPERTY_GETTER(audiomixer_mixer_voice_obj,
 //|
 //|         Sample must be an `audiocore.WaveFile`, `audiocore.RawSample`, `audiomixer.Mixer` or `audiomp3.MP3Decoder`.
 //|
-//|         The sample must match the Mixer's encoding settings given in the constructor."""
+//|         The sample is converted to the Mixer's encoding settings given in the constructor
+//|         if they differ. Converting between sample rates uses linear interpolation."""
 //|         ...
 STATIC mp_obj_t audiomixer_mixer_obj_play(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_sample, ARG_voice, ARG_loop };
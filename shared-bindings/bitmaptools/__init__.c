@@ -140,7 +140,9 @@ STATIC void validate_clip_region(displayio_bitmap_t *bitmap, mp_obj_t clip0_tupl
 //|     source_clip1: Tuple[int, int],
 //|     angle: float,
 //|     scale: float,
-//|     skip_index: int
+//|     skip_index: int,
+//|     bilinear: bool = False,
+//|     colorspace: displayio.Colorspace = displayio.Colorspace.RGB565
 //| ) -> None:
 //|     """Inserts the source bitmap region into the destination bitmap with rotation
 //|     (angle), scale and clipping (both on source and destination bitmaps).
@@ -172,14 +174,19 @@ STATIC void validate_clip_region(displayio_bitmap_t *bitmap, mp_obj_t clip0_tupl
 //|     :param float scale: Scaling factor. Defaults to None which gets treated as 1.0 or same
 //|            as original source size.
 //|     :param int skip_index: Bitmap palette index in the source that will not be copied,
-//|            set to None to copy all pixels"""
+//|            set to None to copy all pixels
+//|     :param bool bilinear: If True, each destination pixel is interpolated from the four
+//|            nearest source pixels instead of copying the single nearest one. Both bitmaps
+//|            must have 16 bits per value.
+//|     :param displayio.Colorspace colorspace: The 16-bit colorspace of both bitmaps, used to
+//|            interpolate each color channel separately when ``bilinear`` is True."""
 //|     ...
 //|
 STATIC mp_obj_t bitmaptools_obj_rotozoom(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum {ARG_dest_bitmap, ARG_source_bitmap,
           ARG_ox, ARG_oy, ARG_dest_clip0, ARG_dest_clip1,
           ARG_px, ARG_py, ARG_source_clip0, ARG_source_clip1,
-          ARG_angle, ARG_scale, ARG_skip_index};
+          ARG_angle, ARG_scale, ARG_skip_index, ARG_bilinear, ARG_colorspace};
 
     static const mp_arg_t allowed_args[] = {
         {MP_QSTR_dest_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL}},
@@ -198,6 +205,8 @@ STATIC mp_obj_t bitmaptools_obj_rotozoom(size_t n_args, const mp_obj_t *pos_args
         {MP_QSTR_angle, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} }, // None convert to 0.0
         {MP_QSTR_scale, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} }, // None convert to 1.0
         {MP_QSTR_skip_index, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        {MP_QSTR_bilinear, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+        {MP_QSTR_colorspace, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -259,6 +268,27 @@ STATIC mp_obj_t bitmaptools_obj_rotozoom(size_t n_args, const mp_obj_t *pos_args
         skip_index_none = false;
     }
 
+    bool bilinear = args[ARG_bilinear].u_bool;
+    displayio_colorspace_t colorspace = DISPLAYIO_COLORSPACE_RGB565;
+    if (args[ARG_colorspace].u_obj != mp_const_none) {
+        colorspace = (displayio_colorspace_t)cp_enum_value(&displayio_colorspace_type, args[ARG_colorspace].u_obj, MP_QSTR_colorspace);
+    }
+    if (bilinear) {
+        switch (colorspace) {
+            case DISPLAYIO_COLORSPACE_RGB565:
+            case DISPLAYIO_COLORSPACE_RGB565_SWAPPED:
+            case DISPLAYIO_COLORSPACE_BGR565:
+            case DISPLAYIO_COLORSPACE_BGR565_SWAPPED:
+                if (destination->bits_per_value != 16 || source->bits_per_value != 16) {
+                    mp_raise_ValueError(MP_ERROR_TEXT("For RGB colorspaces, input bitmap must have 16 bits per pixel"));
+                }
+                break;
+
+            default:
+                mp_raise_ValueError(MP_ERROR_TEXT("Unsupported colorspace"));
+        }
+    }
+
     common_hal_bitmaptools_rotozoom(destination, ox, oy,
         dest_clip0_x, dest_clip0_y,
         dest_clip1_x, dest_clip1_y,
@@ -267,7 +297,8 @@ STATIC mp_obj_t bitmaptools_obj_rotozoom(size_t n_args, const mp_obj_t *pos_args
         source_clip1_x, source_clip1_y,
         angle,
         scale,
-        skip_index, skip_index_none);
+        skip_index, skip_index_none,
+        bilinear, colorspace);
 
     return mp_const_none;
 }
@@ -773,6 +804,10 @@ MP_DEFINE_CONST_FUN_OBJ_KW(bitmaptools_arrayblit_obj, 0, bitmaptools_arrayblit);
 //|
 //|     This function doesn't parse image headers, but is useful to speed up loading of uncompressed image formats such as PCF glyph data.
 //|
+//|     Loading is fastest when ``bits_per_pixel`` equals the bitmap's bits per value and each row fills a whole number of 32-bit words
+//|     (or ``element_size`` is 4), because the data is then read straight into the bitmap. Pixels smaller than a byte also need
+//|     ``reverse_pixels_in_element`` set for this.
+//|
 //|     :param displayio.Bitmap bitmap: A writable bitmap
 //|     :param typing.BinaryIO file: A file opened in binary mode
 //|     :param int bits_per_pixel: Number of bits per pixel.  Values 1, 2, 4, 8, 16, 24, and 32 are supported;
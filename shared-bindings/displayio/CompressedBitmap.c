@@ -0,0 +1,176 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/displayio/CompressedBitmap.h"
+#include "shared-bindings/displayio/Bitmap.h"
+
+#include <stdint.h>
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+//| class CompressedBitmap:
+//|     """A read-only, run length compressed copy of a `Bitmap`
+//|
+//|     Sprite sheets and backgrounds usually contain long runs of the same
+//|     palette index, so storing them compressed can take a fraction of the
+//|     memory of a `Bitmap`. Each row can be decoded independently, so a
+//|     CompressedBitmap can be used as the bitmap of a `TileGrid` with no
+//|     other changes. Reading pixels in row order is nearly as fast as reading
+//|     a `Bitmap`, but random access to a pixel costs a partial decode of its
+//|     row."""
+//|
+//|     def __init__(self, bitmap: Bitmap) -> None:
+//|         """Create a CompressedBitmap with the same size, bits per value and
+//|         content as the given bitmap. Later changes to ``bitmap`` are not
+//|         reflected in the CompressedBitmap.
+//|
+//|         :param Bitmap bitmap: The bitmap to compress"""
+//|         ...
+STATIC mp_obj_t displayio_compressedbitmap_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    mp_arg_check_num(n_args, n_kw, 1, 1, false);
+    displayio_bitmap_t *source = mp_arg_validate_type(all_args[0], &displayio_bitmap_type, MP_QSTR_bitmap);
+
+    displayio_compressedbitmap_t *self = mp_obj_malloc(displayio_compressedbitmap_t, &displayio_compressedbitmap_type);
+    common_hal_displayio_compressedbitmap_construct(self, source);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     width: int
+//|     """Width of the bitmap. (read only)"""
+STATIC mp_obj_t displayio_compressedbitmap_obj_get_width(mp_obj_t self_in) {
+    displayio_compressedbitmap_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_displayio_compressedbitmap_get_width(self));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_compressedbitmap_get_width_obj, displayio_compressedbitmap_obj_get_width);
+
+MP_PROPERTY_GETTER(displayio_compressedbitmap_width_obj,
+    (mp_obj_t)&displayio_compressedbitmap_get_width_obj);
+
+//|     height: int
+//|     """Height of the bitmap. (read only)"""
+STATIC mp_obj_t displayio_compressedbitmap_obj_get_height(mp_obj_t self_in) {
+    displayio_compressedbitmap_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_displayio_compressedbitmap_get_height(self));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_compressedbitmap_get_height_obj, displayio_compressedbitmap_obj_get_height);
+
+MP_PROPERTY_GETTER(displayio_compressedbitmap_height_obj,
+    (mp_obj_t)&displayio_compressedbitmap_get_height_obj);
+
+//|     bits_per_value: int
+//|     """Bits per Pixel of the bitmap. (read only)"""
+STATIC mp_obj_t displayio_compressedbitmap_obj_get_bits_per_value(mp_obj_t self_in) {
+    displayio_compressedbitmap_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_displayio_compressedbitmap_get_bits_per_value(self));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_compressedbitmap_get_bits_per_value_obj, displayio_compressedbitmap_obj_get_bits_per_value);
+
+MP_PROPERTY_GETTER(displayio_compressedbitmap_bits_per_value_obj,
+    (mp_obj_t)&displayio_compressedbitmap_get_bits_per_value_obj);
+
+//|     compressed_size: int
+//|     """Number of bytes used to store the compressed pixel data, including
+//|     the row index. (read only)"""
+STATIC mp_obj_t displayio_compressedbitmap_obj_get_compressed_size(mp_obj_t self_in) {
+    displayio_compressedbitmap_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return mp_obj_new_int_from_uint(common_hal_displayio_compressedbitmap_get_compressed_size(self));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_compressedbitmap_get_compressed_size_obj, displayio_compressedbitmap_obj_get_compressed_size);
+
+MP_PROPERTY_GETTER(displayio_compressedbitmap_compressed_size_obj,
+    (mp_obj_t)&displayio_compressedbitmap_get_compressed_size_obj);
+
+//|     def __getitem__(self, index: Union[Tuple[int, int], int]) -> int:
+//|         """Returns the value at the given index. The index can either be an x,y tuple or an int equal
+//|         to ``y * width + x``.
+//|
+//|         This allows you to::
+//|
+//|           print(compressed_bitmap[0,1])"""
+//|         ...
+//|
+STATIC mp_obj_t compressedbitmap_subscr(mp_obj_t self_in, mp_obj_t index_obj, mp_obj_t value_obj) {
+    if (value_obj != MP_OBJ_SENTINEL) {
+        // delete and store are not supported
+        return MP_OBJ_NULL;
+    }
+    displayio_compressedbitmap_t *self = MP_OBJ_TO_PTR(self_in);
+
+    uint16_t x = 0;
+    uint16_t y = 0;
+    if (mp_obj_is_small_int(index_obj)) {
+        mp_int_t i = MP_OBJ_SMALL_INT_VALUE(index_obj);
+        int total_length = self->width * self->height;
+        if (i < 0 || i >= total_length) {
+            mp_raise_IndexError_varg(MP_ERROR_TEXT("%q must be %d-%d"), MP_QSTR_index, 0, total_length - 1);
+        }
+
+        x = i % self->width;
+        y = i / self->width;
+    } else {
+        mp_obj_t *items;
+        mp_obj_get_array_fixed_n(index_obj, 2, &items);
+        mp_int_t x_in = mp_obj_get_int(items[0]);
+        if (x_in < 0 || x_in >= self->width) {
+            mp_raise_IndexError_varg(MP_ERROR_TEXT("%q must be %d-%d"), MP_QSTR_x, 0, self->width - 1);
+        }
+        mp_int_t y_in = mp_obj_get_int(items[1]);
+        if (y_in < 0 || y_in >= self->height) {
+            mp_raise_IndexError_varg(MP_ERROR_TEXT("%q must be %d-%d"), MP_QSTR_y, 0, self->height - 1);
+        }
+        x = x_in;
+        y = y_in;
+    }
+
+    return mp_obj_new_int_from_uint(common_hal_displayio_compressedbitmap_get_pixel(self, x, y));
+}
+
+STATIC const mp_rom_map_elem_t displayio_compressedbitmap_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&displayio_compressedbitmap_height_obj) },
+    { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&displayio_compressedbitmap_width_obj) },
+    { MP_ROM_QSTR(MP_QSTR_bits_per_value), MP_ROM_PTR(&displayio_compressedbitmap_bits_per_value_obj) },
+    { MP_ROM_QSTR(MP_QSTR_compressed_size), MP_ROM_PTR(&displayio_compressedbitmap_compressed_size_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(displayio_compressedbitmap_locals_dict, displayio_compressedbitmap_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    displayio_compressedbitmap_type,
+    MP_QSTR_CompressedBitmap,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, displayio_compressedbitmap_make_new,
+    locals_dict, &displayio_compressedbitmap_locals_dict,
+    subscr, compressedbitmap_subscr
+    );
@@ -67,10 +67,14 @@
 //|       while True:
 //|           pass"""
 //|
-//|     def __init__(self, file: Union[str, typing.BinaryIO]) -> None:
+//|     def __init__(self, file: Union[str, typing.BinaryIO], *, cache_rows: int = 0) -> None:
 //|         """Create an OnDiskBitmap object with the given file.
 //|
 //|         :param file file: The name of the bitmap file.  For backwards compatibility, a file opened in binary mode may also be passed.
+//|         :param int cache_rows: The number of rows of the image to keep in memory. Rows are read
+//|           from the file in blocks of this size, in the order the display is refreshed. Values
+//|           above 0 make drawing faster at the cost of ``cache_rows`` times the size of one row of
+//|           the file in RAM. The default of 0 disables the cache and reads every pixel from the file.
 //|
 //|         Older versions of CircuitPython required a file opened in binary
 //|         mode. CircuitPython 7.0 modified OnDiskBitmap so that it takes a
@@ -79,18 +83,25 @@
 //|         """
 //|         ...
 STATIC mp_obj_t displayio_ondiskbitmap_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    mp_arg_check_num(n_args, n_kw, 1, 1, false);
-    mp_obj_t arg = all_args[0];
+    enum { ARG_file, ARG_cache_rows };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_cache_rows, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_obj_t arg = args[ARG_file].u_obj;
+    uint16_t cache_rows = mp_arg_validate_int_range(args[ARG_cache_rows].u_int, 0, 32767, MP_QSTR_cache_rows);
 
     if (mp_obj_is_str(arg)) {
         arg = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), arg, MP_ROM_QSTR(MP_QSTR_rb));
     }
-    if (!mp_obj_is_type(arg, &mp_type_fileio)) {
+    if (!mp_obj_is_type(arg, &mp_type_vfs_fat_fileio)) {
         mp_raise_TypeError(MP_ERROR_TEXT("file must be a file opened in byte mode"));
     }
 
     displayio_ondiskbitmap_t *self = mp_obj_malloc(displayio_ondiskbitmap_t, &displayio_ondiskbitmap_type);
-    common_hal_displayio_ondiskbitmap_construct(self, MP_OBJ_TO_PTR(arg));
+    common_hal_displayio_ondiskbitmap_construct(self, MP_OBJ_TO_PTR(arg), cache_rows);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -121,6 +132,33 @@ MP_DEFINE_CONST_FUN_OBJ_1(displayio_ondiskbitmap_get_height_obj, displayio_ondis
 MP_PROPERTY_GETTER(displayio_ondiskbitmap_height_obj,
     (mp_obj_t)&displayio_ondiskbitmap_get_height_obj);
 
+//|     cache_hits: int
+//|     """The number of pixel reads that were served from the row cache. (read only)"""
+STATIC mp_obj_t displayio_ondiskbitmap_obj_get_cache_hits(mp_obj_t self_in) {
+    displayio_ondiskbitmap_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return mp_obj_new_int_from_uint(common_hal_displayio_ondiskbitmap_get_cache_hits(self));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_ondiskbitmap_get_cache_hits_obj, displayio_ondiskbitmap_obj_get_cache_hits);
+
+MP_PROPERTY_GETTER(displayio_ondiskbitmap_cache_hits_obj,
+    (mp_obj_t)&displayio_ondiskbitmap_get_cache_hits_obj);
+
+//|     cache_misses: int
+//|     """The number of pixel reads that had to load a block of rows from the file. The cache hit
+//|     rate is ``cache_hits / (cache_hits + cache_misses)``. (read only)"""
+STATIC mp_obj_t displayio_ondiskbitmap_obj_get_cache_misses(mp_obj_t self_in) {
+    displayio_ondiskbitmap_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return mp_obj_new_int_from_uint(common_hal_displayio_ondiskbitmap_get_cache_misses(self));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_ondiskbitmap_get_cache_misses_obj, displayio_ondiskbitmap_obj_get_cache_misses);
+
+MP_PROPERTY_GETTER(displayio_ondiskbitmap_cache_misses_obj,
+    (mp_obj_t)&displayio_ondiskbitmap_get_cache_misses_obj);
+
 //|     pixel_shader: Union[ColorConverter, Palette]
 //|     """The image's pixel_shader.  The type depends on the underlying
 //|     bitmap's structure.  The pixel shader can be modified (e.g., to set the
@@ -142,6 +180,8 @@ const mp_obj_property_t displayio_ondiskbitmap_pixel_shader_obj = {
 
 
 STATIC const mp_rom_map_elem_t displayio_ondiskbitmap_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_cache_hits), MP_ROM_PTR(&displayio_ondiskbitmap_cache_hits_obj) },
+    { MP_ROM_QSTR(MP_QSTR_cache_misses), MP_ROM_PTR(&displayio_ondiskbitmap_cache_misses_obj) },
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&displayio_ondiskbitmap_height_obj) },
     { MP_ROM_QSTR(MP_QSTR_pixel_shader), MP_ROM_PTR(&displayio_ondiskbitmap_pixel_shader_obj) },
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&displayio_ondiskbitmap_width_obj) },
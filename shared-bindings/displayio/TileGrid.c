@@ -35,6 +35,7 @@
 #include "py/runtime.h"
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/ColorConverter.h"
+#include "shared-bindings/displayio/CompressedBitmap.h"
 #include "shared-bindings/displayio/OnDiskBitmap.h"
 #include "shared-bindings/displayio/Palette.h"
 
@@ -48,7 +49,7 @@
 //|
 //|     def __init__(
 //|         self,
-//|         bitmap: Union[Bitmap, OnDiskBitmap],
+//|         bitmap: Union[Bitmap, CompressedBitmap, OnDiskBitmap],
 //|         *,
 //|         pixel_shader: Union[ColorConverter, Palette],
 //|         width: int = 1,
@@ -67,7 +68,7 @@
 //|
 //|         tile_width and tile_height match the height of the bitmap by default.
 //|
-//|         :param Bitmap,OnDiskBitmap bitmap: The bitmap storing one or more tiles.
+//|         :param Bitmap,CompressedBitmap,OnDiskBitmap bitmap: The bitmap storing one or more tiles.
 //|         :param ColorConverter,Palette pixel_shader: The pixel shader that produces colors from values
 //|         :param int width: Width of the grid in tiles.
 //|         :param int height: Height of the grid in tiles.
@@ -100,6 +101,10 @@ STATIC mp_obj_t displayio_tilegrid_make_new(const mp_obj_type_t *type, size_t n_
         displayio_bitmap_t *bmp = MP_OBJ_TO_PTR(bitmap);
         bitmap_width = bmp->width;
         bitmap_height = bmp->height;
+    } else if (mp_obj_is_type(bitmap, &displayio_compressedbitmap_type)) {
+        displayio_compressedbitmap_t *bmp = MP_OBJ_TO_PTR(bitmap);
+        bitmap_width = bmp->width;
+        bitmap_height = bmp->height;
     } else if (mp_obj_is_type(bitmap, &displayio_ondiskbitmap_type)) {
         displayio_ondiskbitmap_t *bmp = MP_OBJ_TO_PTR(bitmap);
         bitmap_width = bmp->width;
@@ -354,7 +359,7 @@ MP_PROPERTY_GETSET(displayio_tilegrid_pixel_shader_obj,
     (mp_obj_t)&displayio_tilegrid_get_pixel_shader_obj,
     (mp_obj_t)&displayio_tilegrid_set_pixel_shader_obj);
 
-//|     bitmap: Union[Bitmap, OnDiskBitmap]
+//|     bitmap: Union[Bitmap, CompressedBitmap, OnDiskBitmap]
 //|     """The bitmap of the tilegrid."""
 STATIC mp_obj_t displayio_tilegrid_obj_get_bitmap(mp_obj_t self_in) {
     displayio_tilegrid_t *self = native_tilegrid(self_in);
@@ -371,6 +376,10 @@ STATIC mp_obj_t displayio_tilegrid_obj_set_bitmap(mp_obj_t self_in, mp_obj_t bit
         displayio_bitmap_t *bmp = MP_OBJ_TO_PTR(bitmap);
         new_bitmap_width = bmp->width;
         new_bitmap_height = bmp->height;
+    } else if (mp_obj_is_type(bitmap, &displayio_compressedbitmap_type)) {
+        displayio_compressedbitmap_t *bmp = MP_OBJ_TO_PTR(bitmap);
+        new_bitmap_width = bmp->width;
+        new_bitmap_height = bmp->height;
     } else if (mp_obj_is_type(bitmap, &displayio_ondiskbitmap_type)) {
         displayio_ondiskbitmap_t *bmp = MP_OBJ_TO_PTR(bitmap);
         new_bitmap_width = bmp->width;
@@ -384,6 +393,11 @@ STATIC mp_obj_t displayio_tilegrid_obj_set_bitmap(mp_obj_t self_in, mp_obj_t bit
         if (old_bmp->width != new_bitmap_width || old_bmp->height != new_bitmap_height) {
             mp_raise_ValueError(MP_ERROR_TEXT("New bitmap must be same size as old bitmap"));
         }
+    } else if (mp_obj_is_type(self->bitmap, &displayio_compressedbitmap_type)) {
+        displayio_compressedbitmap_t *old_bmp = MP_OBJ_TO_PTR(self->bitmap);
+        if (old_bmp->width != new_bitmap_width || old_bmp->height != new_bitmap_height) {
+            mp_raise_ValueError(MP_ERROR_TEXT("New bitmap must be same size as old bitmap"));
+        }
     } else if (mp_obj_is_type(self->bitmap, &displayio_ondiskbitmap_type)) {
         displayio_ondiskbitmap_t *old_bmp = MP_OBJ_TO_PTR(self->bitmap);
         if (old_bmp->width != new_bitmap_width || old_bmp->height != new_bitmap_height) {
@@ -126,6 +126,25 @@ STATIC mp_obj_t os_getenv(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(os_getenv_obj, 1, os_getenv);
 
+//| def ilistdir(dir: str = ".") -> Iterator[Tuple[str, int, int, int]]:
+//|     """Return an iterator over the entries of the given directory, or the current
+//|     directory if none is given. Each entry is a tuple ``(name, type, inode, size)``
+//|     taken from the directory itself, so no separate `stat` is needed to tell files
+//|     (type ``0x8000``) from directories (type ``0x4000``) or to get file sizes.
+//|     Entries for mount points in the root directory have only the first three fields."""
+//|     ...
+//|
+STATIC mp_obj_t os_ilistdir(size_t n_args, const mp_obj_t *args) {
+    const char *path;
+    if (n_args == 1) {
+        path = mp_obj_str_get_str(args[0]);
+    } else {
+        path = mp_obj_str_get_str(common_hal_os_getcwd());
+    }
+    return common_hal_os_ilistdir(path);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(os_ilistdir_obj, 0, 1, os_ilistdir);
+
 //| def listdir(dir: str) -> str:
 //|     """With no argument, list the current directory.  Otherwise list the given directory."""
 //|     ...
@@ -284,6 +303,20 @@ STATIC mp_obj_t os_utime(mp_obj_t path_in, mp_obj_t times_in) {
 }
 MP_DEFINE_CONST_FUN_OBJ_2(os_utime_obj, os_utime);
 
+//| def walk(top: str) -> Iterator[Tuple[str, List[str], List[str]]]:
+//|     """Walk the directory tree below *top*, yielding a ``(dirpath, dirnames, filenames)``
+//|     tuple for each directory, parents before their children, as CPython's ``os.walk()``
+//|     does by default. Removing names from *dirnames* before the next step skips those
+//|     subdirectories. Directories that can't be listed are skipped, and symbolic links
+//|     are reported as files and not followed."""
+//|     ...
+//|
+STATIC mp_obj_t os_walk(mp_obj_t top_in) {
+    const char *top = mp_obj_str_get_str(top_in);
+    return common_hal_os_walk(top);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(os_walk_obj, os_walk);
+
 STATIC const mp_rom_map_elem_t os_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_os) },
 
@@ -292,6 +325,7 @@ STATIC const mp_rom_map_elem_t os_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_chdir), MP_ROM_PTR(&os_chdir_obj) },
     { MP_ROM_QSTR(MP_QSTR_getcwd), MP_ROM_PTR(&os_getcwd_obj) },
     { MP_ROM_QSTR(MP_QSTR_getenv), MP_ROM_PTR(&os_getenv_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ilistdir), MP_ROM_PTR(&os_ilistdir_obj) },
     { MP_ROM_QSTR(MP_QSTR_listdir), MP_ROM_PTR(&os_listdir_obj) },
     { MP_ROM_QSTR(MP_QSTR_mkdir), MP_ROM_PTR(&os_mkdir_obj) },
     { MP_ROM_QSTR(MP_QSTR_remove), MP_ROM_PTR(&os_remove_obj) },
@@ -301,6 +335,7 @@ STATIC const mp_rom_map_elem_t os_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_statvfs), MP_ROM_PTR(&os_statvfs_obj) },
     { MP_ROM_QSTR(MP_QSTR_unlink), MP_ROM_PTR(&os_remove_obj) }, // unlink aliases to remove
     { MP_ROM_QSTR(MP_QSTR_utime), MP_ROM_PTR(&os_utime_obj) },
+    { MP_ROM_QSTR(MP_QSTR_walk), MP_ROM_PTR(&os_walk_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_sync), MP_ROM_PTR(&os_sync_obj) },
 
@@ -40,6 +40,7 @@ mp_obj_t common_hal_os_getcwd(void);
 mp_obj_t common_hal_os_getenv(const char *key, mp_obj_t default_);
 mp_obj_t common_hal_os_getenv_path(const char *path, const char *key, mp_obj_t default_);
 
+mp_obj_t common_hal_os_ilistdir(const char *path);
 mp_obj_t common_hal_os_listdir(const char *path);
 void common_hal_os_mkdir(const char *path);
 void common_hal_os_remove(const char *path);
@@ -48,6 +49,7 @@ void common_hal_os_rmdir(const char *path);
 mp_obj_t common_hal_os_stat(const char *path);
 mp_obj_t common_hal_os_statvfs(const char *path);
 void common_hal_os_utime(const char *path, mp_obj_t times);
+mp_obj_t common_hal_os_walk(const char *top);
 
 // Returns true if data was correctly sourced from a true random number generator.
 bool common_hal_os_urandom(uint8_t *buffer, mp_uint_t length);
@@ -0,0 +1,212 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "py/binary.h"
+#include "py/enum.h"
+#include "py/objproperty.h"
+#include "py/proto.h"
+#include "py/runtime.h"
+#include "shared-bindings/spectrum/FFT.h"
+#include "shared-module/spectrum/FFT.h"
+
+//| class Window:
+//|     """The window applied to samples before `FFT.magnitude` transforms them"""
+//|
+//|     RECTANGULAR: Window
+//|     """No window. Best for signals that repeat exactly within the transform"""
+//|     HANN: Window
+//|     """A Hann window, a good general purpose choice"""
+//|     HAMMING: Window
+//|     """A Hamming window, with lower nearest side lobes than Hann"""
+//|
+MAKE_ENUM_VALUE(spectrum_window_type, window, RECTANGULAR, SPECTRUM_WINDOW_RECTANGULAR);
+MAKE_ENUM_VALUE(spectrum_window_type, window, HANN, SPECTRUM_WINDOW_HANN);
+MAKE_ENUM_VALUE(spectrum_window_type, window, HAMMING, SPECTRUM_WINDOW_HAMMING);
+
+MAKE_ENUM_MAP(spectrum_window) {
+    MAKE_ENUM_MAP_ENTRY(window, RECTANGULAR),
+    MAKE_ENUM_MAP_ENTRY(window, HANN),
+    MAKE_ENUM_MAP_ENTRY(window, HAMMING),
+};
+
+STATIC MP_DEFINE_CONST_DICT(spectrum_window_locals_dict, spectrum_window_locals_table);
+MAKE_PRINTER(spectrum, spectrum_window);
+MAKE_ENUM_TYPE(spectrum, Window, spectrum_window);
+
+//| class FFT:
+//|     def __init__(self, size: int, *, window: Window = Window.HANN) -> None:
+//|         """A fast Fourier transform of a fixed size.
+//|
+//|         The window, twiddle factors and working buffers are allocated once here, so
+//|         transforms don't allocate memory and can be done from a loop that updates a display.
+//|
+//|         :param int size: The number of samples in each transform, a power of 2 from 4 to 4096
+//|         :param Window window: The window applied by `magnitude`
+//|         """
+//|
+STATIC mp_obj_t spectrum_fft_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_size, ARG_window };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_size, MP_ARG_INT | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_window, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_rom_obj = MP_ROM_PTR(&window_HANN_obj)} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t size = mp_arg_validate_int_range(args[ARG_size].u_int, 4, 4096, MP_QSTR_size);
+    if (size & (size - 1)) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be power of 2"), MP_QSTR_size);
+    }
+    spectrum_window_t window = cp_enum_value(&spectrum_window_type, args[ARG_window].u_obj, MP_QSTR_window);
+
+    spectrum_fft_obj_t *self = mp_obj_malloc(spectrum_fft_obj_t, &spectrum_fft_type);
+    common_hal_spectrum_fft_construct(self, size, window);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     size: int
+//|     """The number of samples in each transform (read-only)"""
+STATIC mp_obj_t spectrum_fft_get_size(mp_obj_t self_in) {
+    spectrum_fft_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_spectrum_fft_get_size(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(spectrum_fft_get_size_obj, spectrum_fft_get_size);
+
+MP_PROPERTY_GETTER(spectrum_fft_size_obj,
+    (mp_obj_t)&spectrum_fft_get_size_obj);
+
+//|     window: Window
+//|     """The window applied by `magnitude` (read-only)"""
+//|
+STATIC mp_obj_t spectrum_fft_get_window(mp_obj_t self_in) {
+    spectrum_fft_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return cp_enum_find(&spectrum_window_type, common_hal_spectrum_fft_get_window(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(spectrum_fft_get_window_obj, spectrum_fft_get_window);
+
+MP_PROPERTY_GETTER(spectrum_fft_window_obj,
+    (mp_obj_t)&spectrum_fft_get_window_obj);
+
+//|     def magnitude(
+//|         self,
+//|         samples: Union[circuitpython_typing.ReadableBuffer, circuitpython_typing.AudioSample],
+//|         out: array.array,
+//|     ) -> None:
+//|         """Compute the spectrum of ``samples`` into ``out`` using fixed point arithmetic.
+//|
+//|         ``samples`` is either a bytearray or array of type 'h', 'H', 'b', or 'B' with at
+//|         least `size` entries, or an audio sample such as `audiocore.WaveFile` or
+//|         `synthio.Synthesizer`. Blocks are read from an audio sample until there are
+//|         `size` samples, using only its first channel. The sample must not be playing
+//|         at the same time.
+//|
+//|         ``out`` must be an array of type 'H' with at least ``size // 2`` entries. Entry
+//|         ``k`` is set to the amplitude of the frequency ``k * sample_rate / size``, in the
+//|         units of 16 bit samples. A full scale sine wave in a single bin gives 32767 with
+//|         `Window.RECTANGULAR` and about half that with `Window.HANN`.
+//|
+//|         Intermediate values are scaled only when they would overflow, so quiet signals
+//|         keep their precision."""
+//|         ...
+STATIC mp_obj_t spectrum_fft_magnitude(mp_obj_t self_in, mp_obj_t samples, mp_obj_t out) {
+    spectrum_fft_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t size = common_hal_spectrum_fft_get_size(self);
+
+    mp_buffer_info_t out_info;
+    mp_get_buffer_raise(out, &out_info, MP_BUFFER_WRITE);
+    if (out_info.typecode != 'H') {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be array of type 'H'"), MP_QSTR_out);
+    }
+    if (out_info.len / sizeof(uint16_t) < size / 2) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q length must be >= %d"), MP_QSTR_out, size / 2);
+    }
+
+    if (mp_proto_get(MP_QSTR_protocol_audiosample, samples)) {
+        common_hal_spectrum_fft_magnitude_from_sample(self, samples, out_info.buf);
+        return mp_const_none;
+    }
+
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(samples, &info, MP_BUFFER_READ);
+    if (info.typecode == BYTEARRAY_TYPECODE) {
+        info.typecode = 'B';
+    }
+    if (info.typecode != 'h' && info.typecode != 'H' && info.typecode != 'b' && info.typecode != 'B') {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be a bytearray or array of type 'h', 'H', 'b', or 'B'"), MP_QSTR_samples);
+    }
+    if (info.len / mp_binary_get_size('@', info.typecode, NULL) < size) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q length must be >= %d"), MP_QSTR_samples, size);
+    }
+    common_hal_spectrum_fft_magnitude_from_buffer(self, &info, out_info.buf);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_3(spectrum_fft_magnitude_obj, spectrum_fft_magnitude);
+
+STATIC float *float_buffer(mp_obj_t obj, size_t size, qstr arg_name) {
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(obj, &info, MP_BUFFER_WRITE);
+    if (info.typecode != 'f') {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be array of type 'f'"), arg_name);
+    }
+    if (info.len / sizeof(float) != size) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q length must be %d"), arg_name, size);
+    }
+    return info.buf;
+}
+
+//|     def transform(self, real: array.array, imag: array.array) -> None:
+//|         """Replace ``real`` and ``imag`` with their discrete Fourier transform, in floating point.
+//|
+//|         Both must be arrays of type 'f' with exactly `size` entries. No window or scaling
+//|         is applied, so the result matches ``numpy.fft.fft``."""
+//|         ...
+//|
+STATIC mp_obj_t spectrum_fft_transform(mp_obj_t self_in, mp_obj_t real, mp_obj_t imag) {
+    spectrum_fft_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t size = common_hal_spectrum_fft_get_size(self);
+    float *re = float_buffer(real, size, MP_QSTR_real);
+    float *im = float_buffer(imag, size, MP_QSTR_imag);
+    common_hal_spectrum_fft_transform(self, re, im);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_3(spectrum_fft_transform_obj, spectrum_fft_transform);
+
+STATIC const mp_rom_map_elem_t spectrum_fft_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_magnitude), MP_ROM_PTR(&spectrum_fft_magnitude_obj) },
+    { MP_ROM_QSTR(MP_QSTR_transform), MP_ROM_PTR(&spectrum_fft_transform_obj) },
+    { MP_ROM_QSTR(MP_QSTR_size), MP_ROM_PTR(&spectrum_fft_size_obj) },
+    { MP_ROM_QSTR(MP_QSTR_window), MP_ROM_PTR(&spectrum_fft_window_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(spectrum_fft_locals_dict, spectrum_fft_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    spectrum_fft_type,
+    MP_QSTR_FFT,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, spectrum_fft_make_new,
+    locals_dict, &spectrum_fft_locals_dict
+    );
@@ -0,0 +1,45 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "py/obj.h"
+
+typedef enum {
+    SPECTRUM_WINDOW_RECTANGULAR, SPECTRUM_WINDOW_HANN, SPECTRUM_WINDOW_HAMMING
+} spectrum_window_t;
+
+typedef struct spectrum_fft_obj spectrum_fft_obj_t;
+extern const mp_obj_type_t spectrum_fft_type;
+extern const mp_obj_type_t spectrum_window_type;
+
+void common_hal_spectrum_fft_construct(spectrum_fft_obj_t *self, uint16_t size, spectrum_window_t window);
+uint16_t common_hal_spectrum_fft_get_size(spectrum_fft_obj_t *self);
+spectrum_window_t common_hal_spectrum_fft_get_window(spectrum_fft_obj_t *self);
+void common_hal_spectrum_fft_magnitude_from_buffer(spectrum_fft_obj_t *self, const mp_buffer_info_t *bufinfo, uint16_t *out);
+void common_hal_spectrum_fft_magnitude_from_sample(spectrum_fft_obj_t *self, mp_obj_t sample, uint16_t *out);
+void common_hal_spectrum_fft_transform(spectrum_fft_obj_t *self, float *re, float *im);
@@ -0,0 +1,62 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/spectrum/FFT.h"
+
+//| """Fast Fourier transforms for audio and sensor data
+//|
+//| For example, to show the spectrum of a microphone recording::
+//|
+//|     import array
+//|     import spectrum
+//|
+//|     fft = spectrum.FFT(256)
+//|     samples = array.array("H", [0] * 256)
+//|     bins = array.array("H", [0] * 128)
+//|     while True:
+//|         mic.record(samples, len(samples))
+//|         fft.magnitude(samples, bins)
+//|         print(max(range(len(bins)), key=bins.__getitem__))
+//| """
+
+STATIC const mp_rom_map_elem_t spectrum_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_spectrum) },
+    { MP_ROM_QSTR(MP_QSTR_FFT), MP_ROM_PTR(&spectrum_fft_type) },
+    { MP_ROM_QSTR(MP_QSTR_Window), MP_ROM_PTR(&spectrum_window_type) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(spectrum_module_globals, spectrum_module_globals_table);
+
+const mp_obj_module_t spectrum_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&spectrum_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_spectrum, spectrum_module);
@@ -275,8 +275,15 @@ STATIC const mp_rom_map_elem_t storage_module_globals_table[] = {
 //|         larger filesystems, but you will need to format the filesystem on another device.
 //|         """
 //|         ...
-//|     def open(self, path: str, mode: str) -> None:
-//|         """Like builtin ``open()``"""
+//|     def open(self, path: str, mode: str, buffering: int = -1) -> None:
+//|         """Like builtin ``open()``.
+//|
+//|         A file opened with mode ``"a"`` or ``"ab"`` and ``buffering`` greater than 1
+//|         is a log file: each ``write()`` is a record kept in a buffer of ``buffering``
+//|         bytes. Records are committed when the buffer is full, on ``flush()`` and
+//|         ``close()``, and about a second after the oldest was written. A commit
+//|         writes the records before it extends the file, so after a power loss the
+//|         file ends after a whole record. Log files cannot be read or seeked."""
 //|         ...
 //|     def ilistdir(
 //|         self, path: str
@@ -296,6 +303,13 @@ STATIC const mp_rom_map_elem_t storage_module_globals_table[] = {
 //|     def statvfs(self, path: int) -> Tuple[int, int, int, int, int, int, int, int, int, int]:
 //|         """Like `os.statvfs`"""
 //|         ...
+//|     def cache_stats(self) -> Optional[Tuple[int, int, int, int]]:
+//|         """Return ``(hits, misses, blocks_read, blocks_written)`` for the sector
+//|         cache between the filesystem and the block device. Hits and misses count
+//|         sectors the filesystem asked for; the others count blocks actually
+//|         transferred, including read-ahead. Returns ``None`` if the filesystem is
+//|         not cached, as is the case for the CIRCUITPY drive."""
+//|         ...
 //|     def mount(self, readonly: bool, mkfs: VfsFat) -> None:
 //|         """Don't call this directly, call `storage.mount`."""
 //|         ...
@@ -0,0 +1,166 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "py/enum.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+#include "shared-bindings/synthio/BlockBiquad.h"
+#include "shared-module/synthio/BlockBiquad.h"
+
+//| class FilterMode:
+//|     """The type of filter of a `BlockBiquad`"""
+//|
+//|     LOW_PASS: FilterMode
+//|     """A low-pass filter"""
+//|     HIGH_PASS: FilterMode
+//|     """A high-pass filter"""
+//|     BAND_PASS: FilterMode
+//|     """A band-pass filter"""
+//|     NOTCH: FilterMode
+//|     """A notch filter"""
+//|
+MAKE_ENUM_VALUE(synthio_filter_mode_type, filter_mode, LOW_PASS, SYNTHIO_LOW_PASS);
+MAKE_ENUM_VALUE(synthio_filter_mode_type, filter_mode, HIGH_PASS, SYNTHIO_HIGH_PASS);
+MAKE_ENUM_VALUE(synthio_filter_mode_type, filter_mode, BAND_PASS, SYNTHIO_BAND_PASS);
+MAKE_ENUM_VALUE(synthio_filter_mode_type, filter_mode, NOTCH, SYNTHIO_NOTCH);
+
+MAKE_ENUM_MAP(synthio_filter_mode) {
+    MAKE_ENUM_MAP_ENTRY(filter_mode, LOW_PASS),
+    MAKE_ENUM_MAP_ENTRY(filter_mode, HIGH_PASS),
+    MAKE_ENUM_MAP_ENTRY(filter_mode, BAND_PASS),
+    MAKE_ENUM_MAP_ENTRY(filter_mode, NOTCH),
+};
+
+STATIC MP_DEFINE_CONST_DICT(synthio_filter_mode_locals_dict, synthio_filter_mode_locals_table);
+MAKE_PRINTER(synthio, synthio_filter_mode);
+MAKE_ENUM_TYPE(synthio, FilterMode, synthio_filter_mode);
+
+static const mp_arg_t block_biquad_properties[] = {
+    { MP_QSTR_mode, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
+    { MP_QSTR_frequency, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
+    { MP_QSTR_Q, MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL } },
+};
+
+//| class BlockBiquad:
+//|     def __init__(self, mode: FilterMode, frequency: BlockInput, Q: BlockInput = 0.7071067811865475) -> None:
+//|         """A biquad filter whose frequency and Q can be `LFO` or `Math` blocks.
+//|
+//|         The coefficients are recomputed from the inputs once per block of 256 samples, and only
+//|         when an input has changed, so sweeping the filter does not allocate any objects.
+//|
+//|         The same BlockBiquad can be used by several notes, each of which keeps its own filter state.
+//|
+//|         :param FilterMode mode: The type of filter
+//|         :param BlockInput frequency: The cutoff or center frequency in Hz, limited to half the sample rate
+//|         :param BlockInput Q: How peaked the response is at the frequency, limited to the range 0.01 to 100
+//|         """
+//|
+STATIC mp_obj_t synthio_block_biquad_make_new(const mp_obj_type_t *type_in, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_mode, ARG_frequency, ARG_Q };
+    mp_arg_val_t args[MP_ARRAY_SIZE(block_biquad_properties)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(block_biquad_properties), block_biquad_properties, args);
+
+    synthio_filter_mode_t mode = cp_enum_value(&synthio_filter_mode_type, args[ARG_mode].u_obj, MP_QSTR_mode);
+    mp_obj_t Q = args[ARG_Q].u_obj;
+    if (Q == MP_OBJ_NULL) {
+        Q = mp_obj_new_float(MICROPY_FLOAT_CONST(0.7071067811865475));
+    }
+
+    synthio_block_biquad_obj_t *self = mp_obj_malloc(synthio_block_biquad_obj_t, &synthio_block_biquad_type);
+    common_hal_synthio_block_biquad_construct(self, mode, args[ARG_frequency].u_obj, Q);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     mode: FilterMode
+//|     """The type of filter (read-only)"""
+STATIC mp_obj_t synthio_block_biquad_get_mode(mp_obj_t self_in) {
+    synthio_block_biquad_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return cp_enum_find(&synthio_filter_mode_type, common_hal_synthio_block_biquad_get_mode(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_block_biquad_get_mode_obj, synthio_block_biquad_get_mode);
+
+MP_PROPERTY_GETTER(synthio_block_biquad_mode_obj,
+    (mp_obj_t)&synthio_block_biquad_get_mode_obj);
+
+//|     frequency: BlockInput
+//|     """The cutoff or center frequency of the filter in Hz"""
+STATIC mp_obj_t synthio_block_biquad_get_frequency(mp_obj_t self_in) {
+    synthio_block_biquad_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_synthio_block_biquad_get_frequency(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_block_biquad_get_frequency_obj, synthio_block_biquad_get_frequency);
+
+STATIC mp_obj_t synthio_block_biquad_set_frequency(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_block_biquad_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_block_biquad_set_frequency(self, arg);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_block_biquad_set_frequency_obj, synthio_block_biquad_set_frequency);
+MP_PROPERTY_GETSET(synthio_block_biquad_frequency_obj,
+    (mp_obj_t)&synthio_block_biquad_get_frequency_obj,
+    (mp_obj_t)&synthio_block_biquad_set_frequency_obj);
+
+//|     Q: BlockInput
+//|     """How peaked the response of the filter is at its frequency"""
+//|
+STATIC mp_obj_t synthio_block_biquad_get_Q(mp_obj_t self_in) {
+    synthio_block_biquad_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_synthio_block_biquad_get_Q(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_block_biquad_get_Q_obj, synthio_block_biquad_get_Q);
+
+STATIC mp_obj_t synthio_block_biquad_set_Q(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_block_biquad_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_block_biquad_set_Q(self, arg);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_block_biquad_set_Q_obj, synthio_block_biquad_set_Q);
+MP_PROPERTY_GETSET(synthio_block_biquad_Q_obj,
+    (mp_obj_t)&synthio_block_biquad_get_Q_obj,
+    (mp_obj_t)&synthio_block_biquad_set_Q_obj);
+
+static void block_biquad_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    (void)kind;
+    properties_print_helper(print, self_in, block_biquad_properties, MP_ARRAY_SIZE(block_biquad_properties));
+}
+
+STATIC const mp_rom_map_elem_t synthio_block_biquad_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_mode), MP_ROM_PTR(&synthio_block_biquad_mode_obj) },
+    { MP_ROM_QSTR(MP_QSTR_frequency), MP_ROM_PTR(&synthio_block_biquad_frequency_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Q), MP_ROM_PTR(&synthio_block_biquad_Q_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(synthio_block_biquad_locals_dict, synthio_block_biquad_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    synthio_block_biquad_type,
+    MP_QSTR_BlockBiquad,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, synthio_block_biquad_make_new,
+    locals_dict, &synthio_block_biquad_locals_dict,
+    print, block_biquad_print
+    );
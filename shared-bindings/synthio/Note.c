@@ -42,6 +42,8 @@ static const mp_arg_t note_properties[] = {
     { MP_QSTR_waveform, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE } },
     { MP_QSTR_waveform_loop_start, MP_ARG_OBJ, {.u_obj = MP_ROM_INT(0) } },
     { MP_QSTR_waveform_loop_end, MP_ARG_OBJ, {.u_obj = MP_ROM_INT(SYNTHIO_WAVEFORM_SIZE) } },
+    { MP_QSTR_interpolate, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_FALSE } },
+    { MP_QSTR_band_limit, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_FALSE } },
     { MP_QSTR_envelope, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE } },
     { MP_QSTR_filter, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE } },
     { MP_QSTR_ring_frequency, MP_ARG_OBJ, {.u_obj = MP_ROM_INT(0) } },
@@ -59,10 +61,12 @@ static const mp_arg_t note_properties[] = {
 //|         waveform: Optional[ReadableBuffer] = None,
 //|         waveform_loop_start: int = 0,
 //|         waveform_loop_end: int = waveform_max_length,
+//|         interpolate: bool = False,
+//|         band_limit: bool = False,
 //|         envelope: Optional[Envelope] = None,
 //|         amplitude: BlockInput = 0.0,
 //|         bend: BlockInput = 0.0,
-//|         filter: Optional[Biquad] = None,
+//|         filter: Optional[FilterChain] = None,
 //|         ring_frequency: float = 0.0,
 //|         ring_bend: float = 0.0,
 //|         ring_waveform: Optional[ReadableBuffer] = 0.0,
@@ -105,12 +109,16 @@ MP_PROPERTY_GETSET(synthio_note_frequency_obj,
     (mp_obj_t)&synthio_note_get_frequency_obj,
     (mp_obj_t)&synthio_note_set_frequency_obj);
 
-//|     filter: Optional[Biquad]
+//|     filter: Optional[FilterChain]
 //|     """If not None, the output of this Note is filtered according to the provided coefficients.
 //|
 //|     Construct an appropriate filter by calling a filter-making method on the
 //|     `Synthesizer` object where you plan to play the note, as filter coefficients depend
-//|     on the sample rate"""
+//|     on the sample rate. Alternatively, use a `BlockBiquad`, whose frequency and Q can
+//|     be changed while the note plays.
+//|
+//|     A sequence of up to 4 filters is applied in order, for example to make a steeper
+//|     low-pass filter. The sequence is read when it is assigned."""
 STATIC mp_obj_t synthio_note_get_filter(mp_obj_t self_in) {
     synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
     return common_hal_synthio_note_get_filter_obj(self);
@@ -265,6 +273,47 @@ MP_PROPERTY_GETSET(synthio_note_waveform_loop_end_obj,
     (mp_obj_t)&synthio_note_get_waveform_loop_end_obj,
     (mp_obj_t)&synthio_note_set_waveform_loop_end_obj);
 
+//|     interpolate: bool
+//|     """When `True`, linearly interpolate between adjacent waveform samples.
+//|
+//|     This reduces the noise of low notes and short waveforms, at some extra CPU cost. Does not apply to the ring waveform."""
+STATIC mp_obj_t synthio_note_get_interpolate(mp_obj_t self_in) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_synthio_note_get_interpolate(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_note_get_interpolate_obj, synthio_note_get_interpolate);
+
+STATIC mp_obj_t synthio_note_set_interpolate(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_note_set_interpolate(self, mp_obj_is_true(arg));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_note_set_interpolate_obj, synthio_note_set_interpolate);
+MP_PROPERTY_GETSET(synthio_note_interpolate_obj,
+    (mp_obj_t)&synthio_note_get_interpolate_obj,
+    (mp_obj_t)&synthio_note_set_interpolate_obj);
+
+//|     band_limit: bool
+//|     """When `True`, high notes are played from successively half-length, low-pass filtered copies of the waveform, which reduces aliasing.
+//|
+//|     The copies are made the first time the note plays with band limiting on, and are kept until the waveform is assigned again, so assign the waveform again after changing its contents.
+//|     Band limiting is skipped while `waveform_loop_start` is not 0."""
+STATIC mp_obj_t synthio_note_get_band_limit(mp_obj_t self_in) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_synthio_note_get_band_limit(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_note_get_band_limit_obj, synthio_note_get_band_limit);
+
+STATIC mp_obj_t synthio_note_set_band_limit(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_note_set_band_limit(self, mp_obj_is_true(arg));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_note_set_band_limit_obj, synthio_note_set_band_limit);
+MP_PROPERTY_GETSET(synthio_note_band_limit_obj,
+    (mp_obj_t)&synthio_note_get_band_limit_obj,
+    (mp_obj_t)&synthio_note_set_band_limit_obj);
+
 
 //|     envelope: Envelope
 //|     """The envelope of this note"""
@@ -412,6 +461,8 @@ STATIC const mp_rom_map_elem_t synthio_note_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_waveform), MP_ROM_PTR(&synthio_note_waveform_obj) },
     { MP_ROM_QSTR(MP_QSTR_waveform_loop_start), MP_ROM_PTR(&synthio_note_waveform_loop_start_obj) },
     { MP_ROM_QSTR(MP_QSTR_waveform_loop_end), MP_ROM_PTR(&synthio_note_waveform_loop_end_obj) },
+    { MP_ROM_QSTR(MP_QSTR_interpolate), MP_ROM_PTR(&synthio_note_interpolate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_band_limit), MP_ROM_PTR(&synthio_note_band_limit_obj) },
     { MP_ROM_QSTR(MP_QSTR_envelope), MP_ROM_PTR(&synthio_note_envelope_obj) },
     { MP_ROM_QSTR(MP_QSTR_amplitude), MP_ROM_PTR(&synthio_note_amplitude_obj) },
     { MP_ROM_QSTR(MP_QSTR_bend), MP_ROM_PTR(&synthio_note_bend_obj) },
@@ -24,6 +24,12 @@ void common_hal_synthio_note_set_bend(synthio_note_obj_t *self, mp_obj_t value);
 mp_obj_t common_hal_synthio_note_get_waveform_obj(synthio_note_obj_t *self);
 void common_hal_synthio_note_set_waveform(synthio_note_obj_t *self, mp_obj_t value);
 
+bool common_hal_synthio_note_get_interpolate(synthio_note_obj_t *self);
+void common_hal_synthio_note_set_interpolate(synthio_note_obj_t *self, bool value);
+
+bool common_hal_synthio_note_get_band_limit(synthio_note_obj_t *self);
+void common_hal_synthio_note_set_band_limit(synthio_note_obj_t *self, bool value);
+
 mp_int_t common_hal_synthio_note_get_waveform_loop_start(synthio_note_obj_t *self);
 void common_hal_synthio_note_set_waveform_loop_start(synthio_note_obj_t *self, mp_int_t value_in);
 
@@ -53,6 +53,8 @@
 //|         channel_count: int = 1,
 //|         waveform: Optional[ReadableBuffer] = None,
 //|         envelope: Optional[Envelope] = None,
+//|         voice_count: int = max_polyphony,
+//|         voice_stealing: bool = False,
 //|     ) -> None:
 //|         """Create a synthesizer object.
 //|
@@ -66,14 +68,18 @@
 //|         :param int channel_count: The number of output channels (1=mono, 2=stereo)
 //|         :param ReadableBuffer waveform: A single-cycle waveform. Default is a 50% duty cycle square wave. If specified, must be a ReadableBuffer of type 'h' (signed 16 bit)
 //|         :param Optional[Envelope] envelope: An object that defines the loudness of a note over time. The default envelope, `None` provides no ramping, voices turn instantly on and off.
+//|         :param int voice_count: The number of notes that can sound at once, from 1 to 256. Each voice needs a few bytes of RAM and, while sounding, CPU time. The default is `max_polyphony`.
+//|         :param bool voice_stealing: When all voices are held, pressing a new note silences the note that was pressed longest ago instead of being ignored.
 //|         """
 STATIC mp_obj_t synthio_synthesizer_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_sample_rate, ARG_channel_count, ARG_waveform, ARG_envelope };
+    enum { ARG_sample_rate, ARG_channel_count, ARG_waveform, ARG_envelope, ARG_voice_count, ARG_voice_stealing };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 11025} },
         { MP_QSTR_channel_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
         { MP_QSTR_waveform, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
         { MP_QSTR_envelope, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
+        { MP_QSTR_voice_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = CIRCUITPY_SYNTHIO_MAX_CHANNELS} },
+        { MP_QSTR_voice_stealing, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -83,6 +89,8 @@ STATIC mp_obj_t synthio_synthesizer_make_new(const mp_obj_type_t *type, size_t n
     common_hal_synthio_synthesizer_construct(self,
         args[ARG_sample_rate].u_int,
         args[ARG_channel_count].u_int,
+        args[ARG_voice_count].u_int,
+        args[ARG_voice_stealing].u_bool,
         args[ARG_waveform].u_obj,
         args[ARG_envelope].u_obj);
 
@@ -167,6 +175,112 @@ STATIC mp_obj_t synthio_synthesizer_change(mp_uint_t n_args, const mp_obj_t *pos
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(synthio_synthesizer_change_obj, 1, synthio_synthesizer_change);
 
+// Times may be big integers once the synthesizer has run for a few hours,
+// only their low 32 bits matter.
+STATIC uint32_t get_time(mp_obj_t time_in) {
+    if (!mp_obj_is_int(time_in)) {
+        mp_arg_validate_type_int(time_in, MP_QSTR_time);
+    }
+    return (uint32_t)mp_obj_int_get_truncated(time_in);
+}
+
+//|     def schedule(
+//|         self,
+//|         time: int,
+//|         *,
+//|         release: NoteOrNoteSequence = (),
+//|         press: NoteOrNoteSequence = (),
+//|         retrigger: LFOOrLFOSequence = (),
+//|     ) -> None:
+//|         """Like `change`, but the changes happen when `sample_time` reaches ``time``.
+//|
+//|         Scheduled changes take effect on exactly that sample, even in the
+//|         middle of a block of output. Times are compared modulo ``2**32`` and
+//|         a time at or before `sample_time` means the start of the next block.
+//|         Changes scheduled for the same time happen in the order they were
+//|         scheduled.
+//|
+//|         Up to 64 changes can be pending. If all of these changes don't fit,
+//|         none of them are scheduled and `RuntimeError` is raised.
+//|
+//|         :param int time: The sample time of the change, usually `sample_time` plus an offset.
+//|         :param NoteOrNoteSequence release: Any sequence of notes.
+//|         :param NoteOrNoteSequence press: Any sequence of notes.
+//|         :param LFOOrLFOSequence retrigger: Any sequence of LFOs."""
+STATIC mp_obj_t synthio_synthesizer_schedule(mp_uint_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_time, ARG_release, ARG_press, ARG_retrigger };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_time, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_release, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_empty_tuple } },
+        { MP_QSTR_press, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_empty_tuple } },
+        { MP_QSTR_retrigger, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_empty_tuple } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    common_hal_synthio_synthesizer_schedule(self, get_time(args[ARG_time].u_obj),
+        args[ARG_release].u_obj, args[ARG_press].u_obj, args[ARG_retrigger].u_obj);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(synthio_synthesizer_schedule_obj, 1, synthio_synthesizer_schedule);
+
+//|     def schedule_change(
+//|         self,
+//|         time: int,
+//|         note: Note,
+//|         *,
+//|         frequency: Optional[float] = None,
+//|         amplitude: Optional[BlockInput] = None,
+//|         bend: Optional[BlockInput] = None,
+//|         panning: Optional[BlockInput] = None,
+//|     ) -> None:
+//|         """Change some of a note's properties when `sample_time` reaches ``time``.
+//|
+//|         Properties given as `None` are left alone. The values are checked
+//|         now, as if they were assigned to the note. Otherwise this works like
+//|         `schedule`.
+//|
+//|         :param int time: The sample time of the change.
+//|         :param Note note: The note to change.
+//|         :param float frequency: The new `Note.frequency`
+//|         :param BlockInput amplitude: The new `Note.amplitude`
+//|         :param BlockInput bend: The new `Note.bend`
+//|         :param BlockInput panning: The new `Note.panning`"""
+STATIC mp_obj_t synthio_synthesizer_schedule_change(mp_uint_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_time, ARG_note, ARG_frequency, ARG_amplitude, ARG_bend, ARG_panning };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_time, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_note, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_frequency, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
+        { MP_QSTR_amplitude, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
+        { MP_QSTR_bend, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
+        { MP_QSTR_panning, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    common_hal_synthio_synthesizer_schedule_change(self, get_time(args[ARG_time].u_obj), args[ARG_note].u_obj,
+        args[ARG_frequency].u_obj, args[ARG_amplitude].u_obj, args[ARG_bend].u_obj, args[ARG_panning].u_obj);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(synthio_synthesizer_schedule_change_obj, 1, synthio_synthesizer_schedule_change);
+
+//|     def cancel_scheduled(self) -> None:
+//|         """Forget every change that was scheduled but has not happened yet."""
+STATIC mp_obj_t synthio_synthesizer_cancel_scheduled(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_synthio_synthesizer_cancel_scheduled(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_cancel_scheduled_obj, synthio_synthesizer_cancel_scheduled);
+
 //
 //|     def release_all_then_press(self, /, press: NoteOrNoteSequence) -> None:
 //|         """Turn any currently-playing notes off, then turn on the given notes
@@ -254,6 +368,22 @@ MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_sample_rate_obj, synthio_synth
 MP_PROPERTY_GETTER(synthio_synthesizer_sample_rate_obj,
     (mp_obj_t)&synthio_synthesizer_get_sample_rate_obj);
 
+//|     sample_time: int
+//|     """The number of samples generated so far, modulo ``2**32`` (read-only property).
+//|
+//|     This is the clock used by `schedule` and `schedule_change`. It
+//|     advances as the output is generated, so it runs ahead of what is
+//|     being heard by the length of the output buffers."""
+STATIC mp_obj_t synthio_synthesizer_obj_get_sample_time(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_synthio_synthesizer_get_sample_time(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_sample_time_obj, synthio_synthesizer_obj_get_sample_time);
+
+MP_PROPERTY_GETTER(synthio_synthesizer_sample_time_obj,
+    (mp_obj_t)&synthio_synthesizer_get_sample_time_obj);
+
 //|     pressed: NoteSequence
 //|     """A sequence of the currently pressed notes (read-only property).
 //|
@@ -304,8 +434,44 @@ MP_PROPERTY_GETTER(synthio_synthesizer_blocks_obj,
     (mp_obj_t)&synthio_synthesizer_get_blocks_obj);
 
 //|     max_polyphony: int
-//|     """Maximum polyphony of the synthesizer (read-only class property)"""
+//|     """Default polyphony of the synthesizer, used when no ``voice_count`` is given (read-only class property)"""
 //|
+//|     voice_count: int
+//|     """The number of notes that can sound at once, as given to the constructor (read-only property)"""
+STATIC mp_obj_t synthio_synthesizer_obj_get_voice_count(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_synthio_synthesizer_get_voice_count(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_voice_count_obj, synthio_synthesizer_obj_get_voice_count);
+
+MP_PROPERTY_GETTER(synthio_synthesizer_voice_count_obj,
+    (mp_obj_t)&synthio_synthesizer_get_voice_count_obj);
+
+//|     voice_stealing: bool
+//|     """When `True` and all voices are held, pressing a new note takes the voice of the note pressed longest ago.
+//|
+//|     When `False`, such presses are ignored. Voices whose notes are in the release phase are always reused first."""
+//|
+STATIC mp_obj_t synthio_synthesizer_obj_get_voice_stealing(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_synthio_synthesizer_get_voice_stealing(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_voice_stealing_obj, synthio_synthesizer_obj_get_voice_stealing);
+
+STATIC mp_obj_t synthio_synthesizer_obj_set_voice_stealing(mp_obj_t self_in, mp_obj_t value) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_synthio_synthesizer_set_voice_stealing(self, mp_obj_is_true(value));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_synthesizer_set_voice_stealing_obj, synthio_synthesizer_obj_set_voice_stealing);
+
+MP_PROPERTY_GETSET(synthio_synthesizer_voice_stealing_obj,
+    (mp_obj_t)&synthio_synthesizer_get_voice_stealing_obj,
+    (mp_obj_t)&synthio_synthesizer_set_voice_stealing_obj);
+
 
 //|     def low_pass_filter(cls, frequency: float, q_factor: float = 0.7071067811865475) -> Biquad:
 //|         """Construct a low-pass filter with the given parameters.
@@ -423,6 +589,9 @@ STATIC const mp_rom_map_elem_t synthio_synthesizer_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_change), MP_ROM_PTR(&synthio_synthesizer_change_obj) },
     { MP_ROM_QSTR(MP_QSTR_release_then_press), MP_ROM_PTR(&synthio_synthesizer_change_obj) },
     { MP_ROM_QSTR(MP_QSTR_release_all_then_press), MP_ROM_PTR(&synthio_synthesizer_release_all_then_press_obj) },
+    { MP_ROM_QSTR(MP_QSTR_schedule), MP_ROM_PTR(&synthio_synthesizer_schedule_obj) },
+    { MP_ROM_QSTR(MP_QSTR_schedule_change), MP_ROM_PTR(&synthio_synthesizer_schedule_change_obj) },
+    { MP_ROM_QSTR(MP_QSTR_cancel_scheduled), MP_ROM_PTR(&synthio_synthesizer_cancel_scheduled_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&synthio_synthesizer_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&synthio_synthesizer___exit___obj) },
@@ -433,7 +602,10 @@ STATIC const mp_rom_map_elem_t synthio_synthesizer_locals_dict_table[] = {
     // Properties
     { MP_ROM_QSTR(MP_QSTR_envelope), MP_ROM_PTR(&synthio_synthesizer_envelope_obj) },
     { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&synthio_synthesizer_sample_rate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sample_time), MP_ROM_PTR(&synthio_synthesizer_sample_time_obj) },
     { MP_ROM_QSTR(MP_QSTR_max_polyphony), MP_ROM_INT(CIRCUITPY_SYNTHIO_MAX_CHANNELS) },
+    { MP_ROM_QSTR(MP_QSTR_voice_count), MP_ROM_PTR(&synthio_synthesizer_voice_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_voice_stealing), MP_ROM_PTR(&synthio_synthesizer_voice_stealing_obj) },
     { MP_ROM_QSTR(MP_QSTR_pressed), MP_ROM_PTR(&synthio_synthesizer_pressed_obj) },
     { MP_ROM_QSTR(MP_QSTR_note_info), MP_ROM_PTR(&synthio_synthesizer_note_info_obj) },
     { MP_ROM_QSTR(MP_QSTR_blocks), MP_ROM_PTR(&synthio_synthesizer_blocks_obj) },
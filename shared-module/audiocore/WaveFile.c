@@ -34,6 +34,8 @@
 
 #include "shared-module/audiocore/WaveFile.h"
 
+#define WAVEFILE_MAX_BLOCK_LENGTH (512)
+
 struct wave_format_chunk {
     uint16_t audio_format;
     uint16_t num_channels;
@@ -109,26 +111,30 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     self->file_length = data_length;
     self->data_start = self->file->fp.fptr;
 
-    // Try to allocate two buffers, one will be loaded from file and the other
-    // DMAed to DAC.
+    // Try to allocate two buffers, one will be loaded from file while blocks
+    // of the other are DMAed to DAC.
     if (buffer_size) {
-        self->len = buffer_size / 2;
+        self->read_ahead_length = buffer_size / 2 / sizeof(uint32_t) * sizeof(uint32_t);
         self->buffer = buffer;
-        self->second_buffer = buffer + self->len;
+        self->second_buffer = buffer + self->read_ahead_length;
     } else {
-        self->len = 256;
-        self->buffer = m_malloc(self->len);
+        self->read_ahead_length = 256;
+        self->buffer = m_malloc(self->read_ahead_length);
         if (self->buffer == NULL) {
             common_hal_audioio_wavefile_deinit(self);
-            m_malloc_fail(self->len);
+            m_malloc_fail(self->read_ahead_length);
         }
 
-        self->second_buffer = m_malloc(self->len);
+        self->second_buffer = m_malloc(self->read_ahead_length);
         if (self->second_buffer == NULL) {
             common_hal_audioio_wavefile_deinit(self);
-            m_malloc_fail(self->len);
+            m_malloc_fail(self->read_ahead_length);
         }
     }
+    // Large buffers are read ahead in one go but still handed out in blocks
+    // no bigger than max_buffer_length.
+    self->len = MIN(self->read_ahead_length, WAVEFILE_MAX_BLOCK_LENGTH);
+    self->chunk_remaining = 0;
 }
 
 void common_hal_audioio_wavefile_deinit(audioio_wavefile_obj_t *self) {
@@ -166,6 +172,7 @@ void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t *self,
     // We don't reset the buffer index in case we're looping and we have an odd number of buffer
     // loads
     self->bytes_remaining = self->file_length;
+    self->chunk_remaining = 0;
     f_lseek(&self->file->fp, self->data_start);
     self->read_count = 0;
     self->left_read_count = 0;
@@ -188,60 +195,49 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *
 
     bool need_more_data = self->read_count == channel_read_count;
 
-    if (self->bytes_remaining == 0 && need_more_data) {
+    if (self->bytes_remaining == 0 && self->chunk_remaining == 0 && need_more_data) {
         *buffer = NULL;
         *buffer_length = 0;
         return GET_BUFFER_DONE;
     }
 
     if (need_more_data) {
-        uint32_t num_bytes_to_load = self->len;
-        if (num_bytes_to_load > self->bytes_remaining) {
-            num_bytes_to_load = self->bytes_remaining;
-        }
-        UINT length_read;
-        if (self->buffer_index % 2 == 1) {
-            *buffer = self->second_buffer;
-        } else {
-            *buffer = self->buffer;
-        }
-        if (f_read(&self->file->fp, *buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
-            return GET_BUFFER_ERROR;
-        }
-        self->bytes_remaining -= length_read;
-        // Pad the last buffer to word align it.
-        if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
-            uint32_t pad = length_read % sizeof(uint32_t);
-            length_read += pad;
-            if (self->bits_per_sample == 8) {
-                for (uint32_t i = 0; i < pad; i++) {
-                    ((uint8_t *)(*buffer))[length_read / sizeof(uint8_t) - i - 1] = 0x80;
-                }
-            } else if (self->bits_per_sample == 16) {
-                // We know the buffer is aligned because we allocated it onto the heap ourselves.
-                #pragma GCC diagnostic push
-                #pragma GCC diagnostic ignored "-Wcast-align"
-                ((int16_t *)(*buffer))[length_read / sizeof(int16_t) - 1] = 0;
-                #pragma GCC diagnostic pop
+        if (self->chunk_remaining == 0) {
+            // Refill the half that isn't holding the blocks handed out last.
+            uint8_t *half = self->buffer_index % 2 == 1 ? self->second_buffer : self->buffer;
+            uint32_t num_bytes_to_load = MIN(self->read_ahead_length, self->bytes_remaining);
+            UINT length_read;
+            if (f_read(&self->file->fp, half, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
+                return GET_BUFFER_ERROR;
             }
+            self->bytes_remaining -= length_read;
+            // Pad the last buffer to word align it. The halves are a multiple
+            // of a word long so the padding always fits.
+            if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
+                uint32_t pad = sizeof(uint32_t) - length_read % sizeof(uint32_t);
+                memset(half + length_read, self->bits_per_sample == 8 ? 0x80 : 0, pad);
+                length_read += pad;
+            }
+            self->chunk = half;
+            self->chunk_remaining = length_read;
+            self->buffer_index += 1;
         }
-        *buffer_length = length_read;
-        if (self->buffer_index % 2 == 1) {
-            self->second_buffer_length = length_read;
-        } else {
-            self->buffer_length = length_read;
-        }
-        self->buffer_index += 1;
+        self->previous_block = self->block;
+        self->previous_block_length = self->block_length;
+        self->block = self->chunk;
+        self->block_length = MIN(self->len, self->chunk_remaining);
+        self->chunk += self->block_length;
+        self->chunk_remaining -= self->block_length;
         self->read_count += 1;
     }
 
     uint32_t buffers_back = self->read_count - 1 - channel_read_count;
-    if ((self->buffer_index - buffers_back) % 2 == 0) {
-        *buffer = self->second_buffer;
-        *buffer_length = self->second_buffer_length;
+    if (buffers_back == 1) {
+        *buffer = self->previous_block;
+        *buffer_length = self->previous_block_length;
     } else {
-        *buffer = self->buffer;
-        *buffer_length = self->buffer_length;
+        *buffer = self->block;
+        *buffer_length = self->block_length;
     }
 
     if (channel == 0) {
@@ -251,7 +247,10 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *
         *buffer = *buffer + self->bits_per_sample / 8;
     }
 
-    return self->bytes_remaining == 0 ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+    if (self->bytes_remaining == 0 && self->chunk_remaining == 0) {
+        return GET_BUFFER_DONE;
+    }
+    return GET_BUFFER_MORE_DATA;
 }
 
 void audioio_wavefile_get_buffer_structure(audioio_wavefile_obj_t *self, bool single_channel_output,
@@ -260,7 +259,7 @@ void audioio_wavefile_get_buffer_structure(audioio_wavefile_obj_t *self, bool si
     *single_buffer = false;
     // In WAV files, 8-bit samples are always unsigned, and larger samples are always signed.
     *samples_signed = self->bits_per_sample > 8;
-    *max_buffer_length = 512;
+    *max_buffer_length = WAVEFILE_MAX_BLOCK_LENGTH;
     if (single_channel_output) {
         *spacing = self->channel_count;
     } else {
@@ -34,10 +34,17 @@
 
 typedef struct {
     mp_obj_base_t base;
+    // The two halves of the read-ahead buffer. Each is filled with a single
+    // read and then handed out in blocks of len bytes without copying.
     uint8_t *buffer;
-    uint32_t buffer_length;
     uint8_t *second_buffer;
-    uint32_t second_buffer_length;
+    uint32_t read_ahead_length;
+    uint8_t *chunk; // Next unread byte in the current half
+    uint32_t chunk_remaining;
+    uint8_t *block; // Most recently returned block
+    uint32_t block_length;
+    uint8_t *previous_block;
+    uint32_t previous_block_length;
     uint32_t file_length; // In bytes
     uint16_t data_start; // Where the data values start
     uint8_t bits_per_sample;
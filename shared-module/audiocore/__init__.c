@@ -27,6 +27,8 @@
 #include "shared-module/audioio/__init__.h"
 
 #include "py/obj.h"
+#include "py/runtime.h"
+#include "py/mperrno.h"
 #include "shared-bindings/audiocore/RawSample.h"
 #include "shared-bindings/audiocore/WaveFile.h"
 #include "shared-module/audiocore/RawSample.h"
@@ -71,6 +73,79 @@ void audiosample_get_buffer_structure(mp_obj_t sample_obj, bool single_channel_o
         samples_signed, max_buffer_length, spacing);
 }
 
+// Pull whole blocks from the sample, as an audio output would, into buffer.
+// Stops at the end of the sample or once another block might not fit, so no
+// data is dropped between calls. Returns the number of bytes written.
+uint32_t audiosample_render_into(mp_obj_t sample_obj, uint8_t *buffer, uint32_t buffer_length, bool *done) {
+    bool single_buffer, samples_signed;
+    uint32_t max_buffer_length;
+    uint8_t spacing;
+    audiosample_get_buffer_structure(sample_obj, false, &single_buffer, &samples_signed, &max_buffer_length, &spacing);
+    if (buffer_length < max_buffer_length) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Buffer too small"));
+    }
+
+    uint32_t written = 0;
+    *done = false;
+    while (buffer_length - written >= max_buffer_length) {
+        uint8_t *block;
+        uint32_t block_length;
+        audioio_get_buffer_result_t result = audiosample_get_buffer(sample_obj, false, 0, &block, &block_length);
+        if (result == GET_BUFFER_ERROR) {
+            mp_raise_OSError(MP_EIO);
+        }
+        // A sample that returns more than it promised loses the excess.
+        block_length = MIN(block_length, buffer_length - written);
+        memcpy(buffer + written, block, block_length);
+        written += block_length;
+        if (result == GET_BUFFER_DONE) {
+            *done = true;
+            break;
+        }
+        // Samples such as MP3Decoder fill their next block in the background.
+        RUN_BACKGROUND_TASKS;
+        mp_handle_pending(true);
+    }
+    return written;
+}
+
+// Pass each block of the sample to writer.write(), until the end of the
+// sample or until length bytes have been written. length is rounded down to
+// whole frames and the last block is cut short to fit it; the rest of that
+// block is dropped. Returns the number of bytes written.
+uint32_t audiosample_render_to_writer(mp_obj_t sample_obj, mp_obj_t writer, uint32_t length, bool *done) {
+    mp_obj_t dest[3];
+    mp_load_method(writer, MP_QSTR_write, dest);
+
+    uint32_t frame_length = audiosample_channel_count(sample_obj) * audiosample_bits_per_sample(sample_obj) / 8;
+    length -= length % frame_length;
+
+    uint32_t written = 0;
+    *done = false;
+    while (written < length) {
+        uint8_t *block;
+        uint32_t block_length;
+        audioio_get_buffer_result_t result = audiosample_get_buffer(sample_obj, false, 0, &block, &block_length);
+        if (result == GET_BUFFER_ERROR) {
+            mp_raise_OSError(MP_EIO);
+        }
+        uint32_t write_length = MIN(block_length, length - written);
+        // The block belongs to the sample and is reused for the next one, so
+        // the writer must consume it before returning, as files do.
+        dest[2] = mp_obj_new_memoryview('B', write_length, block);
+        mp_call_method_n_kw(1, 0, dest);
+        written += write_length;
+        if (result == GET_BUFFER_DONE) {
+            // Only report the end if none of the last block was dropped.
+            *done = write_length == block_length;
+            break;
+        }
+        RUN_BACKGROUND_TASKS;
+        mp_handle_pending(true);
+    }
+    return written;
+}
+
 void audiosample_convert_u8m_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes) {
     for (; nframes--;) {
         int16_t sample = (*buffer_in++ - 0x80) << 8;
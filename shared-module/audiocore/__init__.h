@@ -74,6 +74,9 @@ void audiosample_get_buffer_structure(mp_obj_t sample_obj, bool single_channel_o
     bool *single_buffer, bool *samples_signed,
     uint32_t *max_buffer_length, uint8_t *spacing);
 
+uint32_t audiosample_render_into(mp_obj_t sample_obj, uint8_t *buffer, uint32_t buffer_length, bool *done);
+uint32_t audiosample_render_to_writer(mp_obj_t sample_obj, mp_obj_t writer, uint32_t length, bool *done);
+
 void audiosample_convert_u8m_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes);
 void audiosample_convert_u8s_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes);
 void audiosample_convert_s8m_s16s(int16_t *buffer_out, const int8_t *buffer_in, size_t nframes);
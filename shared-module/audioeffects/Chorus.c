@@ -0,0 +1,145 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-bindings/audioeffects/Chorus.h"
+
+#include <string.h>
+
+#include "py/runtime.h"
+
+// Triangle wave in [-32768, 32767] over a full cycle of phase.
+static inline int32_t triangle(uint32_t phase) {
+    int32_t t = phase >> 15;
+    return t < 65536 ? t - 32768 : 98303 - t;
+}
+
+static void chorus_process(audioeffects_effect_t *effect, int16_t *samples, uint32_t frames) {
+    audioeffects_chorus_obj_t *self = (audioeffects_chorus_obj_t *)effect;
+    uint8_t channels = effect->channel_count;
+    uint32_t line_frames = self->line_frames;
+    int32_t wet = self->mix;
+    int32_t dry = (1 << 15) - wet;
+
+    for (uint32_t f = 0; f < frames; f++) {
+        int16_t *frame = samples + f * channels;
+        int16_t *w = self->line + self->pos * channels;
+        for (uint8_t c = 0; c < channels; c++) {
+            w[c] = frame[c];
+        }
+        for (uint8_t c = 0; c < channels; c++) {
+            // The second channel's sweep lags by a quarter cycle to widen the
+            // stereo image.
+            int32_t tri = triangle(self->lfo_phase + c * (1u << 30));
+            uint32_t d = self->delay + (int32_t)(((int64_t)self->depth * tri) >> 15);
+            uint32_t back = d >> 16;
+            int32_t frac = (d & 0xffff) >> 1;
+            uint32_t a = self->pos >= back ? self->pos - back : self->pos + line_frames - back;
+            uint32_t b = a == 0 ? line_frames - 1 : a - 1;
+            int32_t newer = self->line[a * channels + c];
+            int32_t older = self->line[b * channels + c];
+            int32_t delayed = newer + (((older - newer) * frac) >> 15);
+            frame[c] = audioeffects_clip16((frame[c] * dry + delayed * wet) >> 15);
+        }
+        self->pos = self->pos + 1 == line_frames ? 0 : self->pos + 1;
+        self->lfo_phase += self->lfo_step;
+    }
+}
+
+static void chorus_reset(audioeffects_effect_t *effect) {
+    audioeffects_chorus_obj_t *self = (audioeffects_chorus_obj_t *)effect;
+    memset(self->line, 0, self->line_frames * effect->channel_count * sizeof(int16_t));
+    self->pos = 0;
+    self->lfo_phase = 0;
+}
+
+// Keep the swept delay within the line: depth can't take it below zero or
+// past the oldest frame, which is needed for interpolation.
+static void update_delay(audioeffects_chorus_obj_t *self) {
+    uint32_t max_delay = (self->line_frames - 2) << 16;
+    mp_float_t scale = (mp_float_t)self->effect.sample_rate / 1000 * 65536;
+    self->delay = (uint32_t)MIN(self->delay_ms * scale, (mp_float_t)max_delay);
+    uint32_t depth = (uint32_t)MIN(self->depth_ms * scale, (mp_float_t)max_delay);
+    self->depth = MIN(depth, MIN(self->delay, max_delay - self->delay));
+}
+
+void common_hal_audioeffects_chorus_construct(audioeffects_chorus_obj_t *self, mp_obj_t source,
+    mp_float_t delay_ms, mp_float_t depth_ms, mp_float_t max_delay_ms, mp_float_t rate, mp_float_t mix) {
+    audioeffects_effect_construct(&self->effect, source, chorus_process, chorus_reset);
+    self->line_frames = audioeffects_ms_to_frames(&self->effect, max_delay_ms) + 2;
+    self->line = m_malloc(self->line_frames * self->effect.channel_count * sizeof(int16_t));
+    self->effect.tail_frames = self->line_frames;
+    chorus_reset(&self->effect);
+    self->delay_ms = delay_ms;
+    self->depth_ms = depth_ms;
+    update_delay(self);
+    common_hal_audioeffects_chorus_set_rate(self, rate);
+    common_hal_audioeffects_chorus_set_mix(self, mix);
+}
+
+void common_hal_audioeffects_chorus_deinit(audioeffects_chorus_obj_t *self) {
+    audioeffects_effect_deinit(&self->effect);
+    self->line = NULL;
+}
+
+bool common_hal_audioeffects_chorus_deinited(audioeffects_chorus_obj_t *self) {
+    return audioeffects_effect_deinited(&self->effect);
+}
+
+mp_float_t common_hal_audioeffects_chorus_get_delay_ms(audioeffects_chorus_obj_t *self) {
+    return self->delay_ms;
+}
+
+void common_hal_audioeffects_chorus_set_delay_ms(audioeffects_chorus_obj_t *self, mp_float_t delay_ms) {
+    self->delay_ms = delay_ms;
+    update_delay(self);
+}
+
+mp_float_t common_hal_audioeffects_chorus_get_depth_ms(audioeffects_chorus_obj_t *self) {
+    return self->depth_ms;
+}
+
+void common_hal_audioeffects_chorus_set_depth_ms(audioeffects_chorus_obj_t *self, mp_float_t depth_ms) {
+    self->depth_ms = depth_ms;
+    update_delay(self);
+}
+
+mp_float_t common_hal_audioeffects_chorus_get_rate(audioeffects_chorus_obj_t *self) {
+    return self->rate;
+}
+
+void common_hal_audioeffects_chorus_set_rate(audioeffects_chorus_obj_t *self, mp_float_t rate) {
+    self->rate = rate;
+    self->lfo_step = (uint32_t)(rate / self->effect.sample_rate * MICROPY_FLOAT_CONST(4294967296.));
+}
+
+mp_float_t common_hal_audioeffects_chorus_get_mix(audioeffects_chorus_obj_t *self) {
+    return (mp_float_t)self->mix / (1 << 15);
+}
+
+void common_hal_audioeffects_chorus_set_mix(audioeffects_chorus_obj_t *self, mp_float_t mix) {
+    self->mix = (int32_t)(mix * (1 << 15));
+}
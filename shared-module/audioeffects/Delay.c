@@ -0,0 +1,128 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-bindings/audioeffects/Delay.h"
+
+#include <string.h>
+
+#include "py/runtime.h"
+
+// Each pass covers a run of frames in which neither the read nor the write
+// position wraps and the write position can't catch up with samples read in
+// the same run, so the inner loop has no branches or aliasing and vectorises.
+static void delay_process(audioeffects_effect_t *effect, int16_t *samples, uint32_t frames) {
+    audioeffects_delay_obj_t *self = (audioeffects_delay_obj_t *)effect;
+    uint8_t channels = effect->channel_count;
+    uint32_t line_frames = self->line_frames;
+    uint32_t delay = self->delay_frames;
+    int32_t feedback = self->feedback;
+    int32_t wet = self->mix;
+    int32_t dry = (1 << 15) - wet;
+
+    while (frames) {
+        uint32_t read = self->pos >= delay ? self->pos - delay : self->pos + line_frames - delay;
+        uint32_t n = MIN(MIN(frames, delay), line_frames - delay);
+        n = MIN(n, MIN(line_frames - self->pos, line_frames - read));
+        int16_t *restrict w = self->line + self->pos * channels;
+        const int16_t *restrict r = self->line + read * channels;
+        int16_t *restrict s = samples;
+        for (uint32_t i = 0; i < n * channels; i++) {
+            int32_t x = s[i];
+            int32_t d = r[i];
+            s[i] = audioeffects_clip16((x * dry + d * wet) >> 15);
+            w[i] = audioeffects_clip16(x + ((d * feedback) >> 15));
+        }
+        samples += n * channels;
+        frames -= n;
+        self->pos += n;
+        if (self->pos == line_frames) {
+            self->pos = 0;
+        }
+    }
+}
+
+static void delay_reset(audioeffects_effect_t *effect) {
+    audioeffects_delay_obj_t *self = (audioeffects_delay_obj_t *)effect;
+    memset(self->line, 0, self->line_frames * effect->channel_count * sizeof(int16_t));
+    self->pos = 0;
+}
+
+void common_hal_audioeffects_delay_construct(audioeffects_delay_obj_t *self, mp_obj_t source,
+    mp_float_t delay_ms, mp_float_t max_delay_ms, mp_float_t feedback, mp_float_t mix) {
+    audioeffects_effect_construct(&self->effect, source, delay_process, delay_reset);
+    // A block's worth of slack past the longest delay keeps the samples
+    // written in a pass clear of the ones being read.
+    uint32_t block_frames = self->effect.max_buffer_length / sizeof(int16_t) / self->effect.channel_count;
+    self->max_delay_ms = max_delay_ms;
+    self->max_delay_frames = audioeffects_ms_to_frames(&self->effect, max_delay_ms);
+    self->line_frames = self->max_delay_frames + block_frames;
+    self->line = m_malloc(self->line_frames * self->effect.channel_count * sizeof(int16_t));
+    // An echo is heard at most a whole line after it was written.
+    self->effect.tail_frames = self->line_frames;
+    delay_reset(&self->effect);
+    common_hal_audioeffects_delay_set_delay_ms(self, delay_ms);
+    common_hal_audioeffects_delay_set_feedback(self, feedback);
+    common_hal_audioeffects_delay_set_mix(self, mix);
+}
+
+void common_hal_audioeffects_delay_deinit(audioeffects_delay_obj_t *self) {
+    audioeffects_effect_deinit(&self->effect);
+    self->line = NULL;
+}
+
+bool common_hal_audioeffects_delay_deinited(audioeffects_delay_obj_t *self) {
+    return audioeffects_effect_deinited(&self->effect);
+}
+
+mp_float_t common_hal_audioeffects_delay_get_delay_ms(audioeffects_delay_obj_t *self) {
+    return self->delay_ms;
+}
+
+mp_float_t common_hal_audioeffects_delay_get_max_delay_ms(audioeffects_delay_obj_t *self) {
+    return self->max_delay_ms;
+}
+
+void common_hal_audioeffects_delay_set_delay_ms(audioeffects_delay_obj_t *self, mp_float_t delay_ms) {
+    self->delay_ms = delay_ms;
+    self->delay_frames = MIN(audioeffects_ms_to_frames(&self->effect, delay_ms), self->max_delay_frames);
+}
+
+mp_float_t common_hal_audioeffects_delay_get_feedback(audioeffects_delay_obj_t *self) {
+    return (mp_float_t)self->feedback / (1 << 15);
+}
+
+void common_hal_audioeffects_delay_set_feedback(audioeffects_delay_obj_t *self, mp_float_t feedback) {
+    self->feedback = (int32_t)(feedback * (1 << 15));
+}
+
+mp_float_t common_hal_audioeffects_delay_get_mix(audioeffects_delay_obj_t *self) {
+    return (mp_float_t)self->mix / (1 << 15);
+}
+
+void common_hal_audioeffects_delay_set_mix(audioeffects_delay_obj_t *self, mp_float_t mix) {
+    self->mix = (int32_t)(mix * (1 << 15));
+}
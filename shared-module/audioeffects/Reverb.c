@@ -0,0 +1,199 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-bindings/audioeffects/Reverb.h"
+
+#include <string.h>
+
+#include "py/runtime.h"
+
+// A Schroeder style reverb as used by Freeverb: parallel feedback comb
+// filters with a low pass in the loop, followed by allpass filters in series.
+// Lengths are in frames at 44.1kHz and scaled to the source's sample rate.
+static const uint16_t comb_lengths[AUDIOEFFECTS_REVERB_COMBS] = { 1116, 1188, 1277, 1356 };
+static const uint16_t allpass_lengths[AUDIOEFFECTS_REVERB_ALLPASSES] = { 556, 441 };
+
+static void comb_process(audioeffects_reverb_line_t *comb, const int32_t *in, int32_t *acc, uint32_t frames,
+    int32_t feedback, int32_t damp) {
+    int32_t store = comb->store;
+    int32_t undamp = (1 << 15) - damp;
+    while (frames) {
+        uint32_t n = MIN(frames, comb->length - comb->pos);
+        int16_t *buffer = comb->buffer + comb->pos;
+        for (uint32_t i = 0; i < n; i++) {
+            int32_t out = buffer[i];
+            // Divide rather than shift so that, with no input, the loop
+            // decays to zero instead of settling on a small negative value.
+            store = (out * undamp + store * damp) / (1 << 15);
+            buffer[i] = audioeffects_clip16(in[i] + store * feedback / (1 << 15));
+            acc[i] += out;
+        }
+        in += n;
+        acc += n;
+        frames -= n;
+        comb->pos += n;
+        if (comb->pos == comb->length) {
+            comb->pos = 0;
+        }
+    }
+    comb->store = store;
+}
+
+static void allpass_process(audioeffects_reverb_line_t *allpass, int32_t *acc, uint32_t frames) {
+    while (frames) {
+        uint32_t n = MIN(frames, allpass->length - allpass->pos);
+        int16_t *buffer = allpass->buffer + allpass->pos;
+        for (uint32_t i = 0; i < n; i++) {
+            int32_t in = acc[i];
+            int32_t out = buffer[i];
+            acc[i] = out - in;
+            buffer[i] = audioeffects_clip16(in + out / 2);
+        }
+        acc += n;
+        frames -= n;
+        allpass->pos += n;
+        if (allpass->pos == allpass->length) {
+            allpass->pos = 0;
+        }
+    }
+}
+
+static void reverb_process(audioeffects_effect_t *effect, int16_t *samples, uint32_t frames) {
+    audioeffects_reverb_obj_t *self = (audioeffects_reverb_obj_t *)effect;
+    uint8_t channels = effect->channel_count;
+    int32_t *in = self->scratch;
+    int32_t *acc = self->scratch + effect->max_buffer_length / sizeof(int16_t) / channels;
+
+    // The reverb is mono. Attenuate the input so the combs' gain doesn't clip.
+    for (uint32_t i = 0; i < frames; i++) {
+        int32_t sum = 0;
+        for (uint8_t c = 0; c < channels; c++) {
+            sum += samples[i * channels + c];
+        }
+        in[i] = sum / (channels * 8);
+        acc[i] = 0;
+    }
+    for (size_t j = 0; j < AUDIOEFFECTS_REVERB_COMBS; j++) {
+        comb_process(&self->comb[j], in, acc, frames, self->feedback, self->damp);
+    }
+    for (size_t j = 0; j < AUDIOEFFECTS_REVERB_ALLPASSES; j++) {
+        allpass_process(&self->allpass[j], acc, frames);
+    }
+
+    int32_t wet = self->mix;
+    int32_t dry = (1 << 15) - wet;
+    for (uint32_t i = 0; i < frames; i++) {
+        int32_t w = audioeffects_clip16(acc[i]) * wet;
+        for (uint8_t c = 0; c < channels; c++) {
+            int16_t *s = &samples[i * channels + c];
+            *s = audioeffects_clip16((*s * dry + w) >> 15);
+        }
+    }
+}
+
+static void reverb_reset(audioeffects_effect_t *effect) {
+    audioeffects_reverb_obj_t *self = (audioeffects_reverb_obj_t *)effect;
+    for (size_t j = 0; j < AUDIOEFFECTS_REVERB_COMBS; j++) {
+        memset(self->comb[j].buffer, 0, self->comb[j].length * sizeof(int16_t));
+        self->comb[j].pos = 0;
+        self->comb[j].store = 0;
+    }
+    for (size_t j = 0; j < AUDIOEFFECTS_REVERB_ALLPASSES; j++) {
+        memset(self->allpass[j].buffer, 0, self->allpass[j].length * sizeof(int16_t));
+        self->allpass[j].pos = 0;
+    }
+}
+
+static void line_construct(audioeffects_reverb_line_t *line, uint16_t length, uint32_t sample_rate) {
+    line->length = MAX((uint32_t)length * sample_rate / 44100, 1);
+    line->buffer = m_malloc(line->length * sizeof(int16_t));
+}
+
+void common_hal_audioeffects_reverb_construct(audioeffects_reverb_obj_t *self, mp_obj_t source,
+    mp_float_t room_size, mp_float_t damping, mp_float_t mix) {
+    audioeffects_effect_construct(&self->effect, source, reverb_process, reverb_reset);
+    for (size_t j = 0; j < AUDIOEFFECTS_REVERB_COMBS; j++) {
+        line_construct(&self->comb[j], comb_lengths[j], self->effect.sample_rate);
+    }
+    for (size_t j = 0; j < AUDIOEFFECTS_REVERB_ALLPASSES; j++) {
+        line_construct(&self->allpass[j], allpass_lengths[j], self->effect.sample_rate);
+    }
+    // Sound can circulate in the longest comb and then pass through every
+    // allpass before it is heard.
+    self->effect.tail_frames = self->comb[AUDIOEFFECTS_REVERB_COMBS - 1].length;
+    for (size_t j = 0; j < AUDIOEFFECTS_REVERB_ALLPASSES; j++) {
+        self->effect.tail_frames += self->allpass[j].length;
+    }
+    uint32_t block_frames = self->effect.max_buffer_length / sizeof(int16_t) / self->effect.channel_count;
+    self->scratch = m_malloc(2 * block_frames * sizeof(int32_t));
+    reverb_reset(&self->effect);
+    common_hal_audioeffects_reverb_set_room_size(self, room_size);
+    common_hal_audioeffects_reverb_set_damping(self, damping);
+    common_hal_audioeffects_reverb_set_mix(self, mix);
+}
+
+void common_hal_audioeffects_reverb_deinit(audioeffects_reverb_obj_t *self) {
+    audioeffects_effect_deinit(&self->effect);
+    for (size_t j = 0; j < AUDIOEFFECTS_REVERB_COMBS; j++) {
+        self->comb[j].buffer = NULL;
+    }
+    for (size_t j = 0; j < AUDIOEFFECTS_REVERB_ALLPASSES; j++) {
+        self->allpass[j].buffer = NULL;
+    }
+    self->scratch = NULL;
+}
+
+bool common_hal_audioeffects_reverb_deinited(audioeffects_reverb_obj_t *self) {
+    return audioeffects_effect_deinited(&self->effect);
+}
+
+mp_float_t common_hal_audioeffects_reverb_get_room_size(audioeffects_reverb_obj_t *self) {
+    return self->room_size;
+}
+
+void common_hal_audioeffects_reverb_set_room_size(audioeffects_reverb_obj_t *self, mp_float_t room_size) {
+    self->room_size = room_size;
+    // Freeverb's range of comb feedback, 0.7 to 0.98.
+    self->feedback = (int32_t)((MICROPY_FLOAT_CONST(0.7) + room_size * MICROPY_FLOAT_CONST(0.28)) * (1 << 15));
+}
+
+mp_float_t common_hal_audioeffects_reverb_get_damping(audioeffects_reverb_obj_t *self) {
+    return self->damping;
+}
+
+void common_hal_audioeffects_reverb_set_damping(audioeffects_reverb_obj_t *self, mp_float_t damping) {
+    self->damping = damping;
+    self->damp = (int32_t)(damping * MICROPY_FLOAT_CONST(0.4) * (1 << 15));
+}
+
+mp_float_t common_hal_audioeffects_reverb_get_mix(audioeffects_reverb_obj_t *self) {
+    return (mp_float_t)self->mix / (1 << 15);
+}
+
+void common_hal_audioeffects_reverb_set_mix(audioeffects_reverb_obj_t *self, mp_float_t mix) {
+    self->mix = (int32_t)(mix * (1 << 15));
+}
@@ -0,0 +1,52 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "shared-module/audioeffects/__init__.h"
+
+#define AUDIOEFFECTS_REVERB_COMBS (4)
+#define AUDIOEFFECTS_REVERB_ALLPASSES (2)
+
+typedef struct {
+    int16_t *buffer;
+    uint32_t length;
+    uint32_t pos;
+    int32_t store; // comb filters only: state of the damping low pass
+} audioeffects_reverb_line_t;
+
+typedef struct {
+    audioeffects_effect_t effect;
+    audioeffects_reverb_line_t comb[AUDIOEFFECTS_REVERB_COMBS];
+    audioeffects_reverb_line_t allpass[AUDIOEFFECTS_REVERB_ALLPASSES];
+    int32_t *scratch; // two blocks of mono frames: input and accumulator
+    mp_float_t room_size;
+    mp_float_t damping;
+    int32_t feedback; // Q15
+    int32_t damp; // Q15
+    int32_t mix; // Q15
+} audioeffects_reverb_obj_t;
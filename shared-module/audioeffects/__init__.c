@@ -0,0 +1,221 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-module/audioeffects/__init__.h"
+
+#include <string.h>
+
+#include "py/runtime.h"
+
+void audioeffects_effect_construct(audioeffects_effect_t *self, mp_obj_t source,
+    audioeffects_process_fun process, audioeffects_reset_fun reset) {
+    self->source = source;
+    self->process = process;
+    self->reset = reset;
+    self->sample_rate = audiosample_sample_rate(source);
+    self->channel_count = audiosample_channel_count(source);
+    self->source_bits_per_sample = audiosample_bits_per_sample(source);
+
+    bool single_buffer;
+    uint32_t source_max_buffer_length;
+    uint8_t spacing;
+    audiosample_get_buffer_structure(source, false, &single_buffer, &self->source_signed,
+        &source_max_buffer_length, &spacing);
+
+    // Effects always produce signed 16 bit samples so 8 bit sources take up
+    // twice the space once converted.
+    self->max_buffer_length = source_max_buffer_length * (16 / self->source_bits_per_sample);
+    for (int i = 0; i < 2; i++) {
+        self->buffer[i] = m_malloc(self->max_buffer_length);
+        self->buffer_length[i] = 0;
+    }
+    self->use_first_buffer = true;
+    self->last_result = GET_BUFFER_MORE_DATA;
+    self->tail_frames = 0;
+    self->quiet_frames = 0;
+    self->source_done = false;
+}
+
+void audioeffects_effect_deinit(audioeffects_effect_t *self) {
+    self->buffer[0] = NULL;
+    self->buffer[1] = NULL;
+    self->source = MP_OBJ_NULL;
+}
+
+bool audioeffects_effect_deinited(audioeffects_effect_t *self) {
+    return self->buffer[0] == NULL;
+}
+
+uint32_t audioeffects_ms_to_frames(audioeffects_effect_t *self, mp_float_t ms) {
+    uint32_t frames = (uint32_t)(ms * self->sample_rate / 1000);
+    return MAX(frames, 1);
+}
+
+uint32_t audioeffects_effect_get_sample_rate(audioeffects_effect_t *self) {
+    return self->sample_rate;
+}
+
+uint8_t audioeffects_effect_get_bits_per_sample(audioeffects_effect_t *self) {
+    return 16;
+}
+
+uint8_t audioeffects_effect_get_channel_count(audioeffects_effect_t *self) {
+    return self->channel_count;
+}
+
+void audioeffects_effect_reset_buffer(audioeffects_effect_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    if (single_channel_output && channel == 1) {
+        return;
+    }
+    audiosample_reset_buffer(self->source, false, 0);
+    self->reset(self);
+    self->last_result = GET_BUFFER_MORE_DATA;
+    self->quiet_frames = 0;
+    self->source_done = false;
+    self->read_count = 0;
+    self->left_read_count = 0;
+    self->right_read_count = 0;
+}
+
+// Convert a block of the source into signed 16 bit samples and return the
+// number of whole frames converted.
+static uint32_t convert_block(audioeffects_effect_t *self, int16_t *out, const uint8_t *in, uint32_t length) {
+    uint32_t samples = length / (self->source_bits_per_sample / 8);
+    samples = MIN(samples, self->max_buffer_length / sizeof(int16_t));
+    samples -= samples % self->channel_count;
+    if (self->source_bits_per_sample == 16) {
+        if (self->source_signed) {
+            memcpy(out, in, samples * sizeof(int16_t));
+        } else {
+            // The source buffer isn't necessarily 16 bit aligned.
+            memcpy(out, in, samples * sizeof(int16_t));
+            for (uint32_t i = 0; i < samples; i++) {
+                out[i] ^= 0x8000;
+            }
+        }
+    } else {
+        uint8_t flip = self->source_signed ? 0 : 0x80;
+        for (uint32_t i = 0; i < samples; i++) {
+            out[i] = (int16_t)((int8_t)(in[i] ^ flip) * 256);
+        }
+    }
+    return samples / self->channel_count;
+}
+
+// Integer feedback can leave a sound decaying to a few LSBs instead of zero.
+#define QUIET_LEVEL (8)
+
+static bool is_quiet(const int16_t *samples, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (samples[i] > QUIET_LEVEL || samples[i] < -QUIET_LEVEL) {
+            return false;
+        }
+    }
+    return true;
+}
+
+audioio_get_buffer_result_t audioeffects_effect_get_buffer(audioeffects_effect_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length) {
+    if (!single_channel_output) {
+        channel = 0;
+    }
+
+    uint32_t channel_read_count = self->left_read_count;
+    if (channel == 1) {
+        channel_read_count = self->right_read_count;
+    }
+
+    bool need_more_data = self->read_count == channel_read_count;
+    if (need_more_data) {
+        int i = self->use_first_buffer ? 0 : 1;
+        self->use_first_buffer = !self->use_first_buffer;
+        uint32_t frames = 0;
+        if (self->last_result == GET_BUFFER_MORE_DATA && !self->source_done) {
+            uint8_t *source_buffer;
+            uint32_t source_length;
+            audioio_get_buffer_result_t result = audiosample_get_buffer(self->source, false, 0, &source_buffer, &source_length);
+            if (result == GET_BUFFER_ERROR) {
+                self->last_result = GET_BUFFER_ERROR;
+                return GET_BUFFER_ERROR;
+            }
+            frames = convert_block(self, self->buffer[i], source_buffer, source_length);
+            self->process(self, self->buffer[i], frames);
+            if (result == GET_BUFFER_DONE) {
+                self->source_done = true;
+                if (self->tail_frames == 0) {
+                    self->last_result = GET_BUFFER_DONE;
+                }
+            }
+        } else if (self->last_result == GET_BUFFER_MORE_DATA) {
+            frames = self->max_buffer_length / sizeof(int16_t) / self->channel_count;
+            memset(self->buffer[i], 0, frames * self->channel_count * sizeof(int16_t));
+            self->process(self, self->buffer[i], frames);
+            if (is_quiet(self->buffer[i], frames * self->channel_count)) {
+                self->quiet_frames += frames;
+            } else {
+                self->quiet_frames = 0;
+            }
+            if (self->quiet_frames >= self->tail_frames) {
+                self->last_result = GET_BUFFER_DONE;
+            }
+        }
+        self->buffer_length[i] = frames * self->channel_count * sizeof(int16_t);
+        self->read_count += 1;
+    }
+
+    // The other channel reads the block one behind when this one ran ahead.
+    uint32_t buffers_back = self->read_count - 1 - channel_read_count;
+    int i = (self->use_first_buffer ? 1 : 0) ^ buffers_back;
+    *buffer = (uint8_t *)self->buffer[i];
+    *buffer_length = self->buffer_length[i];
+
+    if (channel == 0) {
+        self->left_read_count += 1;
+    } else if (channel == 1) {
+        self->right_read_count += 1;
+        *buffer = *buffer + sizeof(int16_t);
+    }
+    return self->last_result;
+}
+
+void audioeffects_effect_get_buffer_structure(audioeffects_effect_t *self, bool single_channel_output,
+    bool *single_buffer, bool *samples_signed,
+    uint32_t *max_buffer_length, uint8_t *spacing) {
+    *single_buffer = false;
+    *samples_signed = true;
+    *max_buffer_length = self->max_buffer_length;
+    if (single_channel_output) {
+        *spacing = self->channel_count;
+    } else {
+        *spacing = 1;
+    }
+}
@@ -0,0 +1,97 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+typedef struct audioeffects_effect audioeffects_effect_t;
+
+// Processes frames of interleaved signed 16 bit samples in place.
+typedef void (*audioeffects_process_fun)(audioeffects_effect_t *self, int16_t *samples, uint32_t frames);
+// Clears any history, such as delay lines, when the source restarts.
+typedef void (*audioeffects_reset_fun)(audioeffects_effect_t *self);
+
+// Common state of every effect. Effect objects start with this struct so the
+// audiosample protocol functions below can be shared between them.
+struct audioeffects_effect {
+    mp_obj_base_t base;
+    mp_obj_t source;
+    audioeffects_process_fun process;
+    audioeffects_reset_fun reset;
+    int16_t *buffer[2];
+    uint32_t buffer_length[2]; // in bytes
+    uint32_t max_buffer_length; // in bytes
+    uint32_t sample_rate;
+    uint8_t channel_count;
+    uint8_t source_bits_per_sample;
+    bool source_signed;
+    bool use_first_buffer;
+    audioio_get_buffer_result_t last_result;
+
+    // Once the source has ended, blocks of silence are processed so that
+    // echoes and reverberation die away naturally. The effect ends after its
+    // output has been quiet for tail_frames, which each effect sets to how
+    // long its history can hold on to a sound.
+    uint32_t tail_frames;
+    uint32_t quiet_frames;
+    bool source_done;
+
+    uint32_t read_count;
+    uint32_t left_read_count;
+    uint32_t right_read_count;
+};
+
+void audioeffects_effect_construct(audioeffects_effect_t *self, mp_obj_t source,
+    audioeffects_process_fun process, audioeffects_reset_fun reset);
+void audioeffects_effect_deinit(audioeffects_effect_t *self);
+bool audioeffects_effect_deinited(audioeffects_effect_t *self);
+
+// Convert a time in milliseconds to a whole number of frames, at least one.
+uint32_t audioeffects_ms_to_frames(audioeffects_effect_t *self, mp_float_t ms);
+
+static inline int16_t audioeffects_clip16(int32_t s) {
+    return MIN(MAX(s, INT16_MIN), INT16_MAX);
+}
+
+// These are not available from Python because it may be called in an interrupt.
+uint32_t audioeffects_effect_get_sample_rate(audioeffects_effect_t *self);
+uint8_t audioeffects_effect_get_bits_per_sample(audioeffects_effect_t *self);
+uint8_t audioeffects_effect_get_channel_count(audioeffects_effect_t *self);
+void audioeffects_effect_reset_buffer(audioeffects_effect_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+audioio_get_buffer_result_t audioeffects_effect_get_buffer(audioeffects_effect_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length);                                                   // length in bytes
+void audioeffects_effect_get_buffer_structure(audioeffects_effect_t *self, bool single_channel_output,
+    bool *single_buffer, bool *samples_signed,
+    uint32_t *max_buffer_length, uint8_t *spacing);
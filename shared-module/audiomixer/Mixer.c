@@ -30,14 +30,11 @@
 #include "shared-bindings/audiomixer/MixerVoice.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include "py/runtime.h"
 #include "shared-module/audiocore/__init__.h"
 
-#if defined(__arm__) && __arm__
-#include "cmsis_compiler.h"
-#endif
-
 void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t *self,
     uint8_t voice_count,
     uint32_t buffer_size,
@@ -59,6 +56,13 @@ void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t *self,
         m_malloc_fail(self->len);
     }
 
+    size_t accum_size = self->len / (bits_per_sample / 8) * sizeof(int32_t);
+    self->accum = m_malloc(accum_size);
+    if (self->accum == NULL) {
+        common_hal_audiomixer_mixer_deinit(self);
+        m_malloc_fail(accum_size);
+    }
+
     self->bits_per_sample = bits_per_sample;
     self->samples_signed = samples_signed;
     self->channel_count = channel_count;
@@ -69,6 +73,7 @@ void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t *self,
 void common_hal_audiomixer_mixer_deinit(audiomixer_mixer_obj_t *self) {
     self->first_buffer = NULL;
     self->second_buffer = NULL;
+    self->accum = NULL;
 }
 
 bool common_hal_audiomixer_mixer_deinited(audiomixer_mixer_obj_t *self) {
@@ -104,182 +109,157 @@ void audiomixer_mixer_reset_buffer(audiomixer_mixer_obj_t *self,
     }
 }
 
-__attribute__((always_inline))
-static inline uint32_t add16signed(uint32_t a, uint32_t b) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
-    return __QADD16(a, b);
-    #else
-    uint32_t result = 0;
-    for (int8_t i = 0; i < 2; i++) {
-        int16_t ai = a >> (sizeof(int16_t) * 8 * i);
-        int16_t bi = b >> (sizeof(int16_t) * 8 * i);
-        int32_t intermediate = (int32_t)ai + bi;
-        if (intermediate > SHRT_MAX) {
-            intermediate = SHRT_MAX;
-        } else if (intermediate < SHRT_MIN) {
-            intermediate = SHRT_MIN;
+// Loads the voice's next buffer, restarting the sample when it loops. Returns
+// false and stops the voice once the sample has ended.
+static bool load_voice_buffer(audiomixer_mixervoice_obj_t *voice) {
+    // A looping sample gets one restart to produce data so that an empty
+    // sample can't spin here forever.
+    for (int tries = 0; tries < 2; tries++) {
+        if (!voice->more_data) {
+            if (!voice->loop) {
+                break;
+            }
+            audiosample_reset_buffer(voice->sample, false, 0);
+        }
+        audioio_get_buffer_result_t result = audiosample_get_buffer(voice->sample, false, 0, &voice->remaining_buffer, &voice->buffer_length);
+        voice->more_data = result == GET_BUFFER_MORE_DATA;
+        if (result == GET_BUFFER_ERROR) {
+            break;
+        }
+        if (voice->buffer_length >= voice->bytes_per_frame) {
+            return true;
         }
-        result |= (((uint32_t)intermediate) & 0xffff) << (sizeof(int16_t) * 8 * i);
     }
-    return result;
-    #endif
+    voice->buffer_length = 0;
+    voice->sample = NULL;
+    return false;
 }
 
-__attribute__((always_inline))
-static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
-    mul <<= 16;
-    int32_t hi, lo;
-    enum { bits = 16 }; // saturate to 16 bits
-    enum { shift = 15 }; // shift is done automatically
-    asm volatile ("smulwb %0, %1, %2" : "=r" (lo) : "r" (mul), "r" (val));
-    asm volatile ("smulwt %0, %1, %2" : "=r" (hi) : "r" (mul), "r" (val));
-    asm volatile ("ssat %0, %1, %2, asr %3" : "=r" (lo) : "I" (bits), "r" (lo), "I" (shift));
-    asm volatile ("ssat %0, %1, %2, asr %3" : "=r" (hi) : "I" (bits), "r" (hi), "I" (shift));
-    asm volatile ("pkhbt %0, %1, %2, lsl #16" : "=r" (val) : "r" (lo), "r" (hi)); // pack
-    return val;
-    #else
-    uint32_t result = 0;
-    float mod_mul = (float)mul / (float)((1 << 15) - 1);
-    for (int8_t i = 0; i < 2; i++) {
-        int16_t ai = (val >> (sizeof(uint16_t) * 8 * i));
-        int32_t intermediate = (int32_t)(ai * mod_mul);
-        if (intermediate > SHRT_MAX) {
-            intermediate = SHRT_MAX;
-        } else if (intermediate < SHRT_MIN) {
-            intermediate = SHRT_MIN;
+// Reads one source frame as signed 16 bit samples laid out in the mixer's
+// channel count.
+static bool read_voice_frame(audiomixer_mixervoice_obj_t *voice, uint8_t out_channels, int16_t frame[2]) {
+    if (voice->buffer_length < voice->bytes_per_frame && !load_voice_buffer(voice)) {
+        return false;
+    }
+    int16_t s[2];
+    const uint8_t *src = voice->remaining_buffer;
+    for (uint8_t c = 0; c < voice->channel_count; c++) {
+        if (voice->bits_per_sample == 16) {
+            // The source buffer isn't necessarily 16 bit aligned.
+            uint16_t v;
+            memcpy(&v, src + c * sizeof(v), sizeof(v));
+            s[c] = voice->samples_signed ? (int16_t)v : (int16_t)(v ^ 0x8000);
+        } else {
+            uint8_t v = src[c];
+            s[c] = (int16_t)((voice->samples_signed ? v : v ^ 0x80) << 8);
         }
-        intermediate &= 0x0000FFFF;
-        result |= (((uint32_t)intermediate)) << (sizeof(int16_t) * 8 * i);
     }
-    return result;
-    #endif
-}
+    voice->remaining_buffer += voice->bytes_per_frame;
+    voice->buffer_length -= voice->bytes_per_frame;
 
-static inline uint32_t tounsigned8(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
-    return __UADD8(val, 0x80808080);
-    #else
-    return val ^ 0x80808080;
-    #endif
+    if (voice->channel_count == out_channels) {
+        frame[0] = s[0];
+        if (out_channels == 2) {
+            frame[1] = s[1];
+        }
+    } else if (out_channels == 1) {
+        frame[0] = (s[0] + s[1]) >> 1;
+    } else {
+        frame[0] = frame[1] = s[0];
+    }
+    return true;
 }
 
-static inline uint32_t tounsigned16(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
-    return __UADD16(val, 0x80008000);
-    #else
-    return val ^ 0x80008000;
-    #endif
+// The accumulate loops below are kept free of branches and aliasing so the
+// compiler can vectorise them. Each voice is scaled to 16 bits before it is
+// added, so 255 full scale voices still fit in the 32 bit accumulator.
+static void accumulate16(int32_t *restrict accum, const int16_t *restrict src, uint32_t n, int32_t level) {
+    for (uint32_t i = 0; i < n; i++) {
+        accum[i] += (src[i] * level) >> 15;
+    }
 }
 
-static inline uint32_t tosigned16(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
-    return __UADD16(val, 0x80008000);
-    #else
-    return val ^ 0x80008000;
-    #endif
+static void accumulate16u(int32_t *restrict accum, const uint16_t *restrict src, uint32_t n, int32_t level) {
+    for (uint32_t i = 0; i < n; i++) {
+        accum[i] += (((int32_t)src[i] - 0x8000) * level) >> 15;
+    }
 }
 
-static inline uint32_t unpack8(uint16_t val) {
-    return ((val & 0xff00) << 16) | ((val & 0x00ff) << 8);
+static void accumulate8(int32_t *restrict accum, const int8_t *restrict src, uint32_t n, int32_t level) {
+    for (uint32_t i = 0; i < n; i++) {
+        accum[i] += (src[i] * 256 * level) >> 15;
+    }
 }
 
-static inline uint32_t pack8(uint32_t val) {
-    return ((val & 0xff000000) >> 16) | ((val & 0xff00) >> 8);
+static void accumulate8u(int32_t *restrict accum, const uint8_t *restrict src, uint32_t n, int32_t level) {
+    for (uint32_t i = 0; i < n; i++) {
+        accum[i] += (((int32_t)src[i] - 0x80) * 256 * level) >> 15;
+    }
 }
 
-static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
-    audiomixer_mixervoice_obj_t *voice, bool voices_active,
-    uint32_t *word_buffer, uint32_t length) {
-    while (length != 0) {
-        if (voice->buffer_length == 0) {
-            if (!voice->more_data) {
-                if (voice->loop) {
-                    audiosample_reset_buffer(voice->sample, false, 0);
-                } else {
-                    voice->sample = NULL;
-                    break;
-                }
-            }
-            if (voice->sample) {
-                // Load another buffer
-                audioio_get_buffer_result_t result = audiosample_get_buffer(voice->sample, false, 0, (uint8_t **)&voice->remaining_buffer, &voice->buffer_length);
-                // Track length in terms of words.
-                voice->buffer_length /= sizeof(uint32_t);
-                voice->more_data = result == GET_BUFFER_MORE_DATA;
-            }
-        }
+// Adds `frames` output frames of the voice to the accumulator.
+static void mix_one_voice(audiomixer_mixer_obj_t *self,
+    audiomixer_mixervoice_obj_t *voice, int32_t *accum, uint32_t frames) {
+    int32_t level = voice->level;
+    uint8_t out_channels = self->channel_count;
 
-        uint32_t n = MIN(voice->buffer_length, length);
-        uint32_t *src = voice->remaining_buffer;
-        uint16_t level = voice->level;
-
-        // First active voice gets copied over verbatim.
-        if (!voices_active) {
-            if (MP_LIKELY(self->bits_per_sample == 16)) {
-                if (MP_LIKELY(self->samples_signed)) {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t v = src[i];
-                        word_buffer[i] = mult16signed(v, level);
-                    }
-                } else {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t v = src[i];
-                        v = tosigned16(v);
-                        word_buffer[i] = mult16signed(v, level);
-                    }
-                }
-            } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
-                for (uint32_t i = 0; i < n * 2; i++) {
-                    uint32_t word = unpack8(hsrc[i]);
-                    if (MP_LIKELY(!self->samples_signed)) {
-                        word = tosigned16(word);
-                    }
-                    word = mult16signed(word, level);
-                    hword_buffer[i] = pack8(word);
-                }
+    if (voice->direct) {
+        while (frames != 0) {
+            if (voice->buffer_length < voice->bytes_per_frame && !load_voice_buffer(voice)) {
+                return;
             }
-        } else {
-            if (MP_LIKELY(self->bits_per_sample == 16)) {
-                if (MP_LIKELY(self->samples_signed)) {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t word = src[i];
-                        word_buffer[i] = add16signed(mult16signed(word, level), word_buffer[i]);
-                    }
+            uint32_t n = MIN(voice->buffer_length / voice->bytes_per_frame, frames);
+            uint32_t count = n * out_channels;
+            const void *src = voice->remaining_buffer;
+            if (voice->bits_per_sample == 16) {
+                if (voice->samples_signed) {
+                    accumulate16(accum, src, count, level);
                 } else {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t word = src[i];
-                        word = tosigned16(word);
-                        word_buffer[i] = add16signed(mult16signed(word, level), word_buffer[i]);
-                    }
+                    accumulate16u(accum, src, count, level);
                 }
             } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
-                for (uint32_t i = 0; i < n * 2; i++) {
-                    uint32_t word = unpack8(hsrc[i]);
-                    if (MP_LIKELY(!self->samples_signed)) {
-                        word = tosigned16(word);
-                    }
-                    word = mult16signed(word, level);
-                    word = add16signed(word, unpack8(hword_buffer[i]));
-                    hword_buffer[i] = pack8(word);
+                if (voice->samples_signed) {
+                    accumulate8(accum, src, count, level);
+                } else {
+                    accumulate8u(accum, src, count, level);
                 }
             }
+            accum += count;
+            frames -= n;
+            voice->remaining_buffer += n * voice->bytes_per_frame;
+            voice->buffer_length -= n * voice->bytes_per_frame;
         }
-        length -= n;
-        word_buffer += n;
-        voice->remaining_buffer += n;
-        voice->buffer_length -= n;
+        return;
     }
 
-    if (length && !voices_active) {
-        for (uint32_t i = 0; i < length; i++) {
-            word_buffer[i] = 0;
+    // Resample by linear interpolation between the two source frames that
+    // straddle each output frame.
+    uint32_t step = voice->step;
+    uint32_t phase = voice->phase;
+    int16_t *prev = voice->prev;
+    int16_t *next = voice->next;
+    bool ended = false;
+    for (; frames != 0; frames--) {
+        while (phase >= (1 << 16)) {
+            if (ended) {
+                return;
+            }
+            phase -= 1 << 16;
+            prev[0] = next[0];
+            prev[1] = next[1];
+            if (!read_voice_frame(voice, out_channels, next)) {
+                // Hold the last frame for the rest of its span.
+                ended = true;
+            }
+        }
+        int32_t frac = phase >> 1;
+        for (uint8_t c = 0; c < out_channels; c++) {
+            int32_t s = prev[c] + (((next[c] - prev[c]) * frac) >> 15);
+            *accum++ += (s * level) >> 15;
         }
+        phase += step;
     }
+    voice->phase = phase;
 }
 
 audioio_get_buffer_result_t audiomixer_mixer_get_buffer(audiomixer_mixer_obj_t *self,
@@ -308,32 +288,34 @@ audioio_get_buffer_result_t audiomixer_mixer_get_buffer(audiomixer_mixer_obj_t *
             word_buffer = self->second_buffer;
         }
         self->use_first_buffer = !self->use_first_buffer;
-        bool voices_active = false;
-        uint32_t length = self->len / sizeof(uint32_t);
+
+        uint32_t samples = self->len / (self->bits_per_sample / 8);
+        uint32_t frames = samples / self->channel_count;
+        int32_t *accum = self->accum;
+        memset(accum, 0, samples * sizeof(int32_t));
 
         for (int32_t v = 0; v < self->voice_count; v++) {
             audiomixer_mixervoice_obj_t *voice = MP_OBJ_TO_PTR(self->voice[v]);
             if (voice->sample) {
-                mix_down_one_voice(self, voice, voices_active, word_buffer, length);
-                voices_active = true;
+                mix_one_voice(self, voice, accum, frames);
             }
         }
 
-        if (!voices_active) {
-            for (uint32_t i = 0; i < length; i++) {
-                word_buffer[i] = 0;
+        // Clip once after every voice has been added and convert to the
+        // output format.
+        if (self->bits_per_sample == 16) {
+            int16_t *out = (int16_t *)word_buffer;
+            uint16_t flip = self->samples_signed ? 0 : 0x8000;
+            for (uint32_t i = 0; i < samples; i++) {
+                int32_t s = MIN(MAX(accum[i], SHRT_MIN), SHRT_MAX);
+                out[i] = s ^ flip;
             }
-        }
-
-        if (!self->samples_signed) {
-            if (self->bits_per_sample == 16) {
-                for (uint32_t i = 0; i < length; i++) {
-                    word_buffer[i] = tounsigned16(word_buffer[i]);
-                }
-            } else {
-                for (uint32_t i = 0; i < length; i++) {
-                    word_buffer[i] = tounsigned8(word_buffer[i]);
-                }
+        } else {
+            uint8_t *out = (uint8_t *)word_buffer;
+            uint8_t flip = self->samples_signed ? 0 : 0x80;
+            for (uint32_t i = 0; i < samples; i++) {
+                int32_t s = MIN(MAX(accum[i], SHRT_MIN), SHRT_MAX);
+                out[i] = (s >> 8) ^ flip;
             }
         }
 
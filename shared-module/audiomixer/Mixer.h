@@ -36,7 +36,8 @@ typedef struct {
     mp_obj_base_t base;
     uint32_t *first_buffer;
     uint32_t *second_buffer;
-    uint32_t len; // in words
+    int32_t *accum; // one 32 bit accumulator per output sample
+    uint32_t len; // in bytes
     uint8_t bits_per_sample;
     bool use_first_buffer;
     bool samples_signed;
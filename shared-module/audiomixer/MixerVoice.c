@@ -51,14 +51,18 @@ void common_hal_audiomixer_mixervoice_set_level(audiomixer_mixervoice_obj_t *sel
 }
 
 void common_hal_audiomixer_mixervoice_play(audiomixer_mixervoice_obj_t *self, mp_obj_t sample, bool loop) {
-    if (audiosample_sample_rate(sample) != self->parent->sample_rate) {
-        mp_raise_ValueError(MP_ERROR_TEXT("The sample's sample rate does not match the mixer's"));
+    audiomixer_mixer_obj_t *parent = self->parent;
+    uint32_t sample_rate = audiosample_sample_rate(sample);
+    // Allow at most 256 source frames per output frame so a single output
+    // block can't stall on reading the source.
+    uint64_t step = ((uint64_t)sample_rate << 16) / parent->sample_rate;
+    if (step == 0 || step > (256 << 16)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("The sample's sample rate must be at most 256 times the mixer's"));
     }
-    if (audiosample_channel_count(sample) != self->parent->channel_count) {
-        mp_raise_ValueError(MP_ERROR_TEXT("The sample's channel count does not match the mixer's"));
-    }
-    if (audiosample_bits_per_sample(sample) != self->parent->bits_per_sample) {
-        mp_raise_ValueError(MP_ERROR_TEXT("The sample's bits_per_sample does not match the mixer's"));
+    uint8_t channel_count = mp_arg_validate_int_range(audiosample_channel_count(sample), 1, 2, MP_QSTR_channel_count);
+    uint8_t bits_per_sample = audiosample_bits_per_sample(sample);
+    if (bits_per_sample != 8 && bits_per_sample != 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bits_per_sample must be 8 or 16"));
     }
     bool single_buffer;
     bool samples_signed;
@@ -66,17 +70,29 @@ void common_hal_audiomixer_mixervoice_play(audiomixer_mixervoice_obj_t *self, mp
     uint8_t spacing;
     audiosample_get_buffer_structure(sample, false, &single_buffer, &samples_signed,
         &max_buffer_length, &spacing);
-    if (samples_signed != self->parent->samples_signed) {
-        mp_raise_ValueError(MP_ERROR_TEXT("The sample's signedness does not match the mixer's"));
-    }
-    self->sample = sample;
+
+    // Stop mixing the old sample before changing the format underneath it.
+    self->sample = NULL;
+    self->samples_signed = samples_signed;
+    self->bits_per_sample = bits_per_sample;
+    self->channel_count = channel_count;
+    self->bytes_per_frame = bits_per_sample / 8 * channel_count;
+    self->step = step;
+    self->direct = step == (1 << 16) && channel_count == parent->channel_count;
+    // Two frames have to be read before the first output frame can be
+    // interpolated.
+    self->phase = 2 << 16;
+    self->prev[0] = self->prev[1] = 0;
+    self->next[0] = self->next[1] = 0;
     self->loop = loop;
 
     audiosample_reset_buffer(sample, false, 0);
-    audioio_get_buffer_result_t result = audiosample_get_buffer(sample, false, 0, (uint8_t **)&self->remaining_buffer, &self->buffer_length);
-    // Track length in terms of words.
-    self->buffer_length /= sizeof(uint32_t);
+    audioio_get_buffer_result_t result = audiosample_get_buffer(sample, false, 0, &self->remaining_buffer, &self->buffer_length);
+    if (result == GET_BUFFER_ERROR) {
+        self->buffer_length = 0;
+    }
     self->more_data = result == GET_BUFFER_MORE_DATA;
+    self->sample = sample;
 }
 
 bool common_hal_audiomixer_mixervoice_get_playing(audiomixer_mixervoice_obj_t *self) {
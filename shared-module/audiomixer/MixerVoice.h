@@ -37,8 +37,22 @@ typedef struct {
     mp_obj_t sample;
     bool loop;
     bool more_data;
-    uint32_t *remaining_buffer;
-    uint32_t buffer_length;
+    // Format of the playing sample, captured by play().
+    bool samples_signed;
+    uint8_t bits_per_sample;
+    uint8_t channel_count;
+    uint8_t bytes_per_frame;
+    // True when the sample rate and channel count match the mixer's so whole
+    // blocks can be accumulated without resampling.
+    bool direct;
+    uint8_t *remaining_buffer;
+    uint32_t buffer_length; // in bytes
+    // Resampler state. step is source frames per output frame and phase is the
+    // position between prev and next, both 16.16 fixed point.
+    uint32_t step;
+    uint32_t phase;
+    int16_t prev[2];
+    int16_t next[2];
     uint16_t level;
 } audiomixer_mixervoice_obj_t;
 
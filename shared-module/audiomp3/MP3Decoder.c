@@ -173,10 +173,70 @@ STATIC bool mp3file_get_next_frame_info(audiomp3_mp3file_obj_t *self, MP3FrameIn
     return err == ERR_MP3_NONE;
 }
 
+#define FRAME(self, i) ((int16_t *)(void *)((uint8_t *)(self)->frames + (i) * MAX_BUFFER_LEN))
+
+// Drop any frames decoded ahead. read_index is kept, so that the frames
+// handed out last are not overwritten when looping.
+STATIC void mp3file_clear_frames(audiomp3_mp3file_obj_t *self) {
+    self->ready_count = 0;
+    self->decode_ended = false;
+    self->decode_result = GET_BUFFER_DONE;
+    self->other_channel = -1;
+}
+
+/** Decode the next frame into the ring, after the frames already decoded.
+ *
+ * Sets self->decode_ended once there are no more frames to decode. The frame
+ * decoded along with finding the end of the file is still added.
+ */
+STATIC void mp3file_decode_frame(audiomp3_mp3file_obj_t *self) {
+    mp3file_skip_id3v2(self);
+    if (!mp3file_find_sync_word(self)) {
+        self->decode_ended = true;
+        self->decode_result = self->eof ? GET_BUFFER_DONE : GET_BUFFER_ERROR;
+        return;
+    }
+    int16_t *buffer = FRAME(self, (self->read_index + self->ready_count) % self->frame_count);
+    int bytes_left = BYTES_LEFT(self);
+    uint8_t *inbuf = READ_PTR(self);
+    int err = MP3Decode(self->decoder, &inbuf, &bytes_left, buffer, 0);
+    CONSUME(self, BYTES_LEFT(self) - bytes_left);
+
+    if (err) {
+        self->decode_ended = true;
+        self->decode_result = GET_BUFFER_DONE;
+        return;
+    }
+    self->ready_count++;
+
+    mp3file_skip_id3v2(self);
+    if (!mp3file_find_sync_word(self)) {
+        self->decode_ended = true;
+        self->decode_result = GET_BUFFER_DONE;
+    }
+}
+
+/** Decode frames until decode_ahead of them are waiting to be played. */
+STATIC void mp3file_decode_ahead(audiomp3_mp3file_obj_t *self) {
+    while (self->ready_count < self->decode_ahead && !self->decode_ended) {
+        mp3file_decode_frame(self);
+    }
+}
+
+STATIC void mp3file_decode_ahead_cb(void *self_in) {
+    audiomp3_mp3file_obj_t *self = self_in;
+    // The decoder may have been deinitialized since this was queued.
+    if (self->decoder == NULL || self->frames == NULL) {
+        return;
+    }
+    mp3file_decode_ahead(self);
+}
+
 void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t *self,
     pyb_file_obj_t *file,
     uint8_t *buffer,
-    size_t buffer_size) {
+    size_t buffer_size,
+    uint8_t decode_ahead) {
     // XXX Adafruit_MP3 uses a 2kB input buffer and two 4kB output buffers.
     // for a whopping total of 10kB buffers (+mp3 decoder state and frame buffer)
     // At 44kHz, that's 23ms of output audio data.
@@ -201,24 +261,23 @@ void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t *self,
             MP_ERROR_TEXT("Couldn't allocate decoder"));
     }
 
+    // Besides the frames decoded ahead, the ring holds the frame being
+    // played and the one before it, which DMA may still be reading.
+    self->decode_ahead = decode_ahead;
+    self->frame_count = decode_ahead + 2;
+    self->read_index = 0;
+    size_t frames_length = self->frame_count * MAX_BUFFER_LEN;
     if ((intptr_t)buffer & 1) {
         buffer += 1;
         buffer_size -= 1;
     }
-    if (buffer_size >= 2 * MAX_BUFFER_LEN) {
-        self->buffers[0] = (int16_t *)(void *)buffer;
-        self->buffers[1] = (int16_t *)(void *)(buffer + MAX_BUFFER_LEN);
+    if (buffer_size >= frames_length) {
+        self->frames = (int16_t *)(void *)buffer;
     } else {
-        self->buffers[0] = m_malloc(MAX_BUFFER_LEN);
-        if (self->buffers[0] == NULL) {
+        self->frames = m_malloc(frames_length);
+        if (self->frames == NULL) {
             common_hal_audiomp3_mp3file_deinit(self);
-            m_malloc_fail(MAX_BUFFER_LEN);
-        }
-
-        self->buffers[1] = m_malloc(MAX_BUFFER_LEN);
-        if (self->buffers[1] == NULL) {
-            common_hal_audiomp3_mp3file_deinit(self);
-            m_malloc_fail(MAX_BUFFER_LEN);
+            m_malloc_fail(frames_length);
         }
     }
 
@@ -240,8 +299,8 @@ void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t *self, pyb_file
     // this is necessary to avoid a glitch at the start of playback of a second
     // track using the same decoder object means there's still a bug in
     // get_buffer() that I didn't understand.
-    memset(self->buffers[0], 0, MAX_BUFFER_LEN);
-    memset(self->buffers[1], 0, MAX_BUFFER_LEN);
+    memset(self->frames, 0, self->frame_count * MAX_BUFFER_LEN);
+    mp3file_clear_frames(self);
     MP3FrameInfo fi;
     bool result = mp3file_get_next_frame_info(self, &fi);
     background_callback_end_critical_section();
@@ -255,20 +314,24 @@ void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t *self, pyb_file
     self->frame_buffer_size = fi.outputSamps * sizeof(int16_t);
     self->len = 2 * self->frame_buffer_size;
     self->samples_decoded = 0;
+    self->underruns = 0;
+
+    background_callback_begin_critical_section();
+    mp3file_decode_ahead(self);
+    background_callback_end_critical_section();
 }
 
 void common_hal_audiomp3_mp3file_deinit(audiomp3_mp3file_obj_t *self) {
     MP3FreeDecoder(self->decoder);
     self->decoder = NULL;
     self->inbuf = NULL;
-    self->buffers[0] = NULL;
-    self->buffers[1] = NULL;
+    self->frames = NULL;
     self->file = NULL;
     self->samples_decoded = 0;
 }
 
 bool common_hal_audiomp3_mp3file_deinited(audiomp3_mp3file_obj_t *self) {
-    return self->buffers[0] == NULL;
+    return self->frames == NULL;
 }
 
 uint32_t common_hal_audiomp3_mp3file_get_sample_rate(audiomp3_mp3file_obj_t *self) {
@@ -294,8 +357,8 @@ void audiomp3_mp3file_reset_buffer(audiomp3_mp3file_obj_t *self,
     if (single_channel_output && channel == 1) {
         return;
     }
-    // We don't reset the buffer index in case we're looping and we have an odd number of buffer
-    // loads
+    // We don't reset the read index in case we're looping and the last
+    // frames handed out are still playing
     background_callback_begin_critical_section();
     f_lseek(&self->file->fp, 0);
     self->inbuf_offset = self->inbuf_length;
@@ -305,6 +368,13 @@ void audiomp3_mp3file_reset_buffer(audiomp3_mp3file_obj_t *self,
     mp3file_update_inbuf_half(self);
     mp3file_skip_id3v2(self);
     mp3file_find_sync_word(self);
+    mp3file_clear_frames(self);
+    if (self->decode_ahead > 0) {
+        // A looping mixer voice gets here from get_buffer(), so decode just
+        // one frame to keep playing and leave the rest to the background.
+        mp3file_decode_frame(self);
+        background_callback_add(&self->decode_cb, mp3file_decode_ahead_cb, self);
+    }
     background_callback_end_critical_section();
 }
 
@@ -324,38 +394,44 @@ audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t *
     *buffer_length = self->frame_buffer_size;
 
     if (channel == self->other_channel) {
-        *bufptr = (uint8_t *)(self->buffers[self->other_buffer_index] + channel);
+        *bufptr = (uint8_t *)(FRAME(self, self->other_buffer_index) + channel);
         self->other_channel = -1;
         self->samples_decoded += *buffer_length / sizeof(int16_t);
         return GET_BUFFER_MORE_DATA;
     }
 
+    if (self->ready_count == 0) {
+        if (self->decode_ended) {
+            *buffer_length = 0;
+            return self->decode_result;
+        }
+        // Nothing was decoded ahead, either because decode_ahead is 0 or
+        // because the background decoding fell behind, so decode now.
+        if (self->decode_ahead > 0) {
+            self->underruns++;
+        }
+        mp3file_decode_frame(self);
+        if (self->ready_count == 0) {
+            *buffer_length = 0;
+            return self->decode_result;
+        }
+    }
 
-    self->buffer_index = !self->buffer_index;
+    self->buffer_index = self->read_index;
+    self->read_index = (self->read_index + 1) % self->frame_count;
+    self->ready_count--;
     self->other_channel = 1 - channel;
     self->other_buffer_index = self->buffer_index;
-    int16_t *buffer = (int16_t *)(void *)self->buffers[self->buffer_index];
-    *bufptr = (uint8_t *)buffer;
-
-    mp3file_skip_id3v2(self);
-    if (!mp3file_find_sync_word(self)) {
-        *buffer_length = 0;
-        return self->eof ? GET_BUFFER_DONE : GET_BUFFER_ERROR;
-    }
-    int bytes_left = BYTES_LEFT(self);
-    uint8_t *inbuf = READ_PTR(self);
-    int err = MP3Decode(self->decoder, &inbuf, &bytes_left, buffer, 0);
-    CONSUME(self, BYTES_LEFT(self) - bytes_left);
-
-    if (err) {
-        *buffer_length = 0;
-        return GET_BUFFER_DONE;
-    }
+    *bufptr = (uint8_t *)FRAME(self, self->buffer_index);
 
     self->samples_decoded += *buffer_length / sizeof(int16_t);
 
-    mp3file_skip_id3v2(self);
-    int result = mp3file_find_sync_word(self) ? GET_BUFFER_MORE_DATA : GET_BUFFER_DONE;
+    audioio_get_buffer_result_t result = GET_BUFFER_MORE_DATA;
+    if (self->ready_count == 0 && self->decode_ended) {
+        result = self->decode_result;
+    } else if (self->ready_count < self->decode_ahead) {
+        background_callback_add(&self->decode_cb, mp3file_decode_ahead_cb, self);
+    }
 
     if (self->inbuf_offset >= 512) {
         background_callback_add(
@@ -383,7 +459,7 @@ void audiomp3_mp3file_get_buffer_structure(audiomp3_mp3file_obj_t *self, bool si
 float common_hal_audiomp3_mp3file_get_rms_level(audiomp3_mp3file_obj_t *self) {
     float sumsq = 0.f;
     // Assumes no DC component to the audio.  Is that a safe assumption?
-    int16_t *buffer = (int16_t *)(void *)self->buffers[self->buffer_index];
+    int16_t *buffer = FRAME(self, self->buffer_index);
     for (size_t i = 0; i < self->frame_buffer_size / sizeof(int16_t); i++) {
         sumsq += (float)buffer[i] * buffer[i];
     }
@@ -393,3 +469,11 @@ float common_hal_audiomp3_mp3file_get_rms_level(audiomp3_mp3file_obj_t *self) {
 uint32_t common_hal_audiomp3_mp3file_get_samples_decoded(audiomp3_mp3file_obj_t *self) {
     return self->samples_decoded;
 }
+
+uint8_t common_hal_audiomp3_mp3file_get_decode_ahead(audiomp3_mp3file_obj_t *self) {
+    return self->decode_ahead;
+}
+
+uint32_t common_hal_audiomp3_mp3file_get_underruns(audiomp3_mp3file_obj_t *self) {
+    return self->underruns;
+}
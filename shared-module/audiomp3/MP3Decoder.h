@@ -38,10 +38,19 @@ typedef struct {
     mp_obj_base_t base;
     struct _MP3DecInfo *decoder;
     background_callback_t inbuf_fill_cb;
+    background_callback_t decode_cb;
     uint8_t *inbuf;
     uint32_t inbuf_length;
     uint32_t inbuf_offset;
-    int16_t *buffers[2];
+    // A ring of frame_count decoded frames, each MAX_BUFFER_LEN bytes. Up to
+    // decode_ahead frames starting at read_index are decoded and waiting to
+    // be played. The two frames before read_index were the last ones handed
+    // out, and may still be playing.
+    int16_t *frames;
+    uint8_t frame_count;
+    uint8_t decode_ahead;
+    uint8_t read_index;
+    uint8_t ready_count;
     uint32_t len;
     uint32_t frame_buffer_size;
 
@@ -51,11 +60,16 @@ typedef struct {
     uint8_t buffer_index;
     uint8_t channel_count;
     bool eof;
+    // Set once decoding has stopped, with the result to report after the
+    // last decoded frame is played.
+    bool decode_ended;
+    audioio_get_buffer_result_t decode_result;
 
     int8_t other_channel;
     int8_t other_buffer_index;
 
     uint32_t samples_decoded;
+    uint32_t underruns;
 } audiomp3_mp3file_obj_t;
 
 // These are not available from Python because it may be called in an interrupt.
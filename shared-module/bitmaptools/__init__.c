@@ -43,6 +43,107 @@
 #define BITMAP_DEBUG(...) (void)0
 // #define BITMAP_DEBUG(...) mp_printf(&mp_plat_print, __VA_ARGS__)
 
+// rotozoom walks the source bitmap with 16.16 fixed point coordinates
+#define ROTOZOOM_FRAC_BITS (16)
+#define ROTOZOOM_ONE (1 << ROTOZOOM_FRAC_BITS)
+
+static int64_t rotozoom_to_fixed(mp_float_t value) {
+    return (int64_t)MICROPY_FLOAT_C_FUN(floor)(value * ROTOZOOM_ONE + MICROPY_FLOAT_CONST(0.5));
+}
+
+// Per-pixel steps are limited so they can be accumulated in 32 bits; a step
+// this large moves outside any bitmap after a single pixel anyway.
+static int32_t rotozoom_step_to_fixed(mp_float_t value) {
+    int64_t step = rotozoom_to_fixed(value);
+    return (int32_t)MIN(MAX(step, -0x40000000), 0x40000000);
+}
+
+// Integer division rounding towards -infinity / +infinity; den must be positive
+static int64_t floor_div64(int64_t num, int64_t den) {
+    int64_t q = num / den;
+    return (num % den != 0 && num < 0) ? q - 1 : q;
+}
+
+static int64_t ceil_div64(int64_t num, int64_t den) {
+    int64_t q = num / den;
+    return (num % den != 0 && num > 0) ? q + 1 : q;
+}
+
+// Narrow the inclusive range [*x0, *x1] to those x for which
+// lo <= start + x * step < hi
+static void rotozoom_clip_span(int64_t start, int32_t step, int64_t lo, int64_t hi, int32_t *x0, int32_t *x1) {
+    int64_t first, last;
+    if (step == 0) {
+        if (start < lo || start >= hi) {
+            *x1 = *x0 - 1;
+        }
+        return;
+    } else if (step > 0) {
+        first = ceil_div64(lo - start, step);
+        last = floor_div64(hi - 1 - start, step);
+    } else {
+        first = ceil_div64(start - (hi - 1), -(int64_t)step);
+        last = floor_div64(start - lo, -(int64_t)step);
+    }
+    if (first > *x0) {
+        *x0 = first > *x1 ? *x1 + 1 : (int32_t)first;
+    }
+    if (last < *x1) {
+        *x1 = last < *x0 ? *x0 - 1 : (int32_t)last;
+    }
+}
+
+// Spread an RGB565 pixel so each channel has headroom to be multiplied by a
+// 5 bit weight: 00000GGGGGG00000RRRRR000000BBBBB
+static inline uint32_t rgb565_spread(uint32_t c) {
+    return (c | (c << 16)) & 0x07e0f81f;
+}
+
+static inline uint32_t rgb565_lerp(uint32_t a, uint32_t b, uint32_t w) {
+    return (a + (((b - a) * w) >> 5)) & 0x07e0f81f;
+}
+
+// Sample a 16 bit RGB565 (or BGR565) bitmap at the fixed point location (u, v)
+// by interpolating between the four nearest pixel centres.  Pixels outside
+// the clip window are replaced by the nearest pixel on its edge.
+static uint16_t rotozoom_sample_bilinear(displayio_bitmap_t *source, int32_t u, int32_t v,
+    int16_t clip0_x, int16_t clip0_y, int16_t clip1_x, int16_t clip1_y, bool swap) {
+    uint16_t *data = (uint16_t *)source->data;
+    int stride = source->stride * 2;
+
+    u -= ROTOZOOM_ONE / 2;
+    v -= ROTOZOOM_ONE / 2;
+    int x0 = u >> ROTOZOOM_FRAC_BITS, y0 = v >> ROTOZOOM_FRAC_BITS;
+    uint32_t wx = (u >> (ROTOZOOM_FRAC_BITS - 5)) & 31;
+    uint32_t wy = (v >> (ROTOZOOM_FRAC_BITS - 5)) & 31;
+    if (x0 < clip0_x) {
+        x0 = clip0_x;
+        wx = 0;
+    }
+    if (y0 < clip0_y) {
+        y0 = clip0_y;
+        wy = 0;
+    }
+    int x1 = x0 + 1 < clip1_x ? x0 + 1 : x0;
+    int y1 = y0 + 1 < clip1_y ? y0 + 1 : y0;
+
+    uint16_t *row0 = data + y0 * stride;
+    uint16_t *row1 = data + y1 * stride;
+    uint32_t c00 = row0[x0], c01 = row0[x1], c10 = row1[x0], c11 = row1[x1];
+    if (swap) {
+        c00 = __builtin_bswap16(c00);
+        c01 = __builtin_bswap16(c01);
+        c10 = __builtin_bswap16(c10);
+        c11 = __builtin_bswap16(c11);
+    }
+
+    uint32_t top = rgb565_lerp(rgb565_spread(c00), rgb565_spread(c01), wx);
+    uint32_t bottom = rgb565_lerp(rgb565_spread(c10), rgb565_spread(c11), wx);
+    uint32_t c = rgb565_lerp(top, bottom, wy);
+    c = (c | (c >> 16)) & 0xffff;
+    return swap ? __builtin_bswap16(c) : c;
+}
+
 void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16_t oy,
     int16_t dest_clip0_x, int16_t dest_clip0_y,
     int16_t dest_clip1_x, int16_t dest_clip1_y,
@@ -51,7 +152,8 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     int16_t source_clip1_x, int16_t source_clip1_y,
     mp_float_t angle,
     mp_float_t scale,
-    uint32_t skip_index, bool skip_index_none) {
+    uint32_t skip_index, bool skip_index_none,
+    bool bilinear, displayio_colorspace_t colorspace) {
 
     // Copies region from source to the destination bitmap, including rotation,
     // scaling and clipping of either the source or destination regions
@@ -71,6 +173,9 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     // skip_index: color index that should be ignored (and not copied over)
     // skip_index_none: if skip_index_none is True, then all color indexes should be copied
     //                                                     (that is, no color indexes should be skipped)
+    // bilinear: interpolate between source pixels instead of using the nearest one;
+    //           both bitmaps must be 16 bits per value
+    // colorspace: 16-bit colorspace of both bitmaps, used when bilinear is True
 
 
     // Copy complete "source" bitmap into "self" bitmap at location x,y in the "self"
@@ -200,27 +305,77 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     mp_float_t startu = px - (ox * dvCol + oy * duCol);
     mp_float_t startv = py - (ox * dvRow + oy * duRow);
 
-    mp_float_t rowu = startu + miny * duCol;
-    mp_float_t rowv = startv + miny * dvCol;
-
     displayio_area_t dirty_area = {minx, miny, maxx + 1, maxy + 1, NULL};
     displayio_bitmap_set_dirty_area(self, &dirty_area);
 
-    for (y = miny; y <= maxy; y++) {
-        mp_float_t u = rowu + minx * duRow;
-        mp_float_t v = rowv + minx * dvRow;
-        for (x = minx; x <= maxx; x++) {
-            if (u >= source_clip0_x && u < source_clip1_x && v >= source_clip0_y && v < source_clip1_y) {
-                uint32_t c = common_hal_displayio_bitmap_get_pixel(source, (int)u, (int)v);
+    if (minx > maxx || miny > maxy || scale <= 0) {
+        return;
+    }
+
+    // From here on everything is done in 16.16 fixed point, so that the only
+    // floating point operations are the handful needed to set up the DDA.
+    // The source coordinate at the top left of the scanned area is the
+    // anchor; all other positions are reached by integer steps from it.
+    int32_t du_row = rotozoom_step_to_fixed(duRow);
+    int32_t dv_row = rotozoom_step_to_fixed(dvRow);
+    int32_t du_col = rotozoom_step_to_fixed(duCol);
+    int32_t dv_col = rotozoom_step_to_fixed(dvCol);
+    int64_t rowu = rotozoom_to_fixed(startu + minx * duRow + miny * duCol);
+    int64_t rowv = rotozoom_to_fixed(startv + minx * dvRow + miny * dvCol);
+
+    int64_t ulo = (int64_t)source_clip0_x << ROTOZOOM_FRAC_BITS;
+    int64_t uhi = (int64_t)source_clip1_x << ROTOZOOM_FRAC_BITS;
+    int64_t vlo = (int64_t)source_clip0_y << ROTOZOOM_FRAC_BITS;
+    int64_t vhi = (int64_t)source_clip1_y << ROTOZOOM_FRAC_BITS;
+
+    bool fast16 = source->bits_per_value == 16 && self->bits_per_value == 16;
+    bool swap = (colorspace == DISPLAYIO_COLORSPACE_RGB565_SWAPPED) || (colorspace == DISPLAYIO_COLORSPACE_BGR565_SWAPPED);
+
+    for (y = miny; y <= maxy; y++, rowu += du_col, rowv += dv_col) {
+        // Work out which destination pixels on this row land inside the
+        // source clip window, so the inner loop needs no bounds checks.
+        int32_t x0 = 0, x1 = maxx - minx;
+        rotozoom_clip_span(rowu, du_row, ulo, uhi, &x0, &x1);
+        rotozoom_clip_span(rowv, dv_row, vlo, vhi, &x0, &x1);
+        if (x0 > x1) {
+            continue;
+        }
+
+        // Within the span both coordinates are in [0, clip1) so fit in 32
+        // bits; unsigned so that stepping past the end of the span is harmless
+        uint32_t u = (uint32_t)(rowu + (int64_t)x0 * du_row);
+        uint32_t v = (uint32_t)(rowv + (int64_t)x0 * dv_row);
+        int16_t xstart = minx + x0, xend = minx + x1;
+
+        if (bilinear) {
+            uint16_t *dptr = (uint16_t *)(self->data + y * self->stride) + xstart;
+            for (x = xstart; x <= xend; x++, u += du_row, v += dv_row, dptr++) {
+                if (!skip_index_none) {
+                    // skip wherever nearest neighbour sampling would have skipped
+                    uint16_t c = ((uint16_t *)(source->data + (v >> ROTOZOOM_FRAC_BITS) * source->stride))[u >> ROTOZOOM_FRAC_BITS];
+                    if (c == skip_index) {
+                        continue;
+                    }
+                }
+                *dptr = rotozoom_sample_bilinear(source, u, v,
+                    source_clip0_x, source_clip0_y, source_clip1_x, source_clip1_y, swap);
+            }
+        } else if (fast16) {
+            uint16_t *dptr = (uint16_t *)(self->data + y * self->stride) + xstart;
+            for (x = xstart; x <= xend; x++, u += du_row, v += dv_row, dptr++) {
+                uint16_t c = ((uint16_t *)(source->data + (v >> ROTOZOOM_FRAC_BITS) * source->stride))[u >> ROTOZOOM_FRAC_BITS];
+                if ((skip_index_none) || (c != skip_index)) {
+                    *dptr = c;
+                }
+            }
+        } else {
+            for (x = xstart; x <= xend; x++, u += du_row, v += dv_row) {
+                uint32_t c = common_hal_displayio_bitmap_get_pixel(source, u >> ROTOZOOM_FRAC_BITS, v >> ROTOZOOM_FRAC_BITS);
                 if ((skip_index_none) || (c != skip_index)) {
                     displayio_bitmap_write_pixel(self, x, y, c);
                 }
             }
-            u += duRow;
-            v += dvRow;
         }
-        rowu += duCol;
-        rowv += dvCol;
     }
 }
 
@@ -578,10 +733,70 @@ void common_hal_bitmaptools_arrayblit(displayio_bitmap_t *self, void *data, int
     displayio_bitmap_set_dirty_area(self, &area);
 }
 
+// Rows that have to be converted a pixel at a time are read this many bytes at a time.
+#define READINTO_BUFFER_SIZE (256)
+
+// How the 32-bit words of file data must be rearranged to match the bitmap's
+// storage when the file rows can be read straight into it.
+typedef enum {
+    READINTO_FIXUP_NONE,
+    READINTO_FIXUP_BSWAP16,
+    READINTO_FIXUP_BSWAP32,
+    READINTO_FIXUP_SWAP_HALVES,
+} readinto_fixup_t;
+
+// Rows in the file that hold the same pixels as the bitmap's rows, in the same
+// number of bytes, can be read into the bitmap without going through a row
+// buffer and converting each pixel.
+STATIC bool readinto_direct_fixup(displayio_bitmap_t *self, size_t rowsize, int element_size, int bits_per_pixel, bool reverse_pixels_in_element, bool swap_bytes, readinto_fixup_t *fixup) {
+    if ((uint32_t)bits_per_pixel != self->bits_per_value || rowsize != self->stride * sizeof(uint32_t)) {
+        return false;
+    }
+    readinto_fixup_t swap = READINTO_FIXUP_NONE;
+    if (swap_bytes && element_size == 2) {
+        swap = READINTO_FIXUP_BSWAP16;
+    } else if (swap_bytes && element_size == 4) {
+        swap = READINTO_FIXUP_BSWAP32;
+    }
+    if (bits_per_pixel >= 8) {
+        // Whole-byte pixels are stored natively, just as they are read.
+        *fixup = swap;
+        return true;
+    }
+    // Smaller pixels are packed from the most significant end of each
+    // little endian word, so the first pixel is in the word's last byte.
+    if (!MP_ENDIANNESS_LITTLE || !reverse_pixels_in_element) {
+        return false;
+    }
+    switch (swap) {
+        case READINTO_FIXUP_BSWAP16:
+            *fixup = READINTO_FIXUP_SWAP_HALVES;
+            break;
+        case READINTO_FIXUP_BSWAP32:
+            *fixup = READINTO_FIXUP_NONE;
+            break;
+        default:
+            *fixup = READINTO_FIXUP_BSWAP32;
+            break;
+    }
+    return true;
+}
+
+STATIC void readinto_read(mp_obj_t file, void *buf, size_t size) {
+    int error = 0;
+    mp_uint_t bytes_read = mp_stream_read_exactly(file, buf, size, &error);
+    if (error) {
+        mp_raise_OSError(error);
+    }
+    if (bytes_read != size) {
+        mp_raise_msg(&mp_type_EOFError, NULL);
+    }
+}
+
 void common_hal_bitmaptools_readinto(displayio_bitmap_t *self, mp_obj_t *file, int element_size, int bits_per_pixel, bool reverse_pixels_in_element, bool swap_bytes, bool reverse_rows) {
     uint32_t mask = (1 << common_hal_displayio_bitmap_get_bits_per_value(self)) - 1;
 
-    const mp_stream_p_t *file_proto = mp_get_stream_raise(file, MP_STREAM_OP_READ);
+    mp_get_stream_raise(file, MP_STREAM_OP_READ);
 
     displayio_area_t a = {0, 0, self->width, self->height, NULL};
     displayio_bitmap_set_dirty_area(self, &a);
@@ -591,22 +806,65 @@ void common_hal_bitmaptools_readinto(displayio_bitmap_t *self, mp_obj_t *file, i
     size_t rowsize_in_u32 = (rowsize + sizeof(uint32_t) - 1) / sizeof(uint32_t);
     size_t rowsize_in_u16 = (rowsize + sizeof(uint16_t) - 1) / sizeof(uint16_t);
 
+    readinto_fixup_t fixup;
+    if (readinto_direct_fixup(self, rowsize, element_size, bits_per_pixel, reverse_pixels_in_element, swap_bytes, &fixup)) {
+        uint8_t *data = (uint8_t *)self->data;
+        if (reverse_rows) {
+            for (int y = self->height - 1; y >= 0; y--) {
+                readinto_read(file, data + y * rowsize, rowsize);
+            }
+        } else {
+            readinto_read(file, data, rowsize * self->height);
+        }
+        size_t words = self->stride * self->height;
+        switch (fixup) {
+            case READINTO_FIXUP_BSWAP16:
+                for (size_t i = 0; i < words * 2; i++) {
+                    ((uint16_t *)self->data)[i] = __builtin_bswap16(((uint16_t *)self->data)[i]);
+                }
+                break;
+            case READINTO_FIXUP_BSWAP32:
+                for (size_t i = 0; i < words; i++) {
+                    self->data[i] = __builtin_bswap32(self->data[i]);
+                }
+                break;
+            case READINTO_FIXUP_SWAP_HALVES:
+                for (size_t i = 0; i < words; i++) {
+                    self->data[i] = self->data[i] << 16 | self->data[i] >> 16;
+                }
+                break;
+            default:
+                break;
+        }
+        return;
+    }
+
+    // Otherwise read as many rows at a time as fit in a small buffer, and
+    // convert them a pixel at a time.
+    size_t buffer_in_u32 = MAX(rowsize_in_u32, READINTO_BUFFER_SIZE / sizeof(uint32_t));
+    uint32_t buffer[buffer_in_u32];
+    int rows_per_read = buffer_in_u32 * sizeof(uint32_t) / MAX(rowsize, 1);
+    int rows_buffered = 0;
+    uint8_t *row = NULL;
+
     for (int y = 0; y < self->height; y++) {
-        uint32_t rowdata32[rowsize_in_u32];
+        if (rows_buffered == 0) {
+            rows_buffered = MIN(rows_per_read, self->height - y);
+            readinto_read(file, buffer, rows_buffered * rowsize);
+            row = (uint8_t *)buffer;
+        }
+        // Rows of 16 and 32 bit pixels are a multiple of 2 and 4 bytes long, so stay aligned.
+        // rowdata32 may be misaligned for narrower pixels, but then it isn't dereferenced.
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wcast-align"
+        uint32_t *rowdata32 = (uint32_t *)row;
+        #pragma GCC diagnostic pop
+        row += rowsize;
+        rows_buffered--;
         uint16_t *rowdata16 = (uint16_t *)rowdata32;
         uint8_t *rowdata8 = (uint8_t *)rowdata32;
         const int y_draw = reverse_rows ? (self->height) - 1 - y : y;
 
-
-        int error = 0;
-        mp_uint_t bytes_read = file_proto->read(file, rowdata32, rowsize, &error);
-        if (error) {
-            mp_raise_OSError(error);
-        }
-        if (bytes_read != rowsize) {
-            mp_raise_msg(&mp_type_EOFError, NULL);
-        }
-
         if (swap_bytes) {
             switch (element_size) {
                 case 2:
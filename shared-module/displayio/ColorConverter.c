@@ -46,6 +46,8 @@ void common_hal_displayio_colorconverter_construct(displayio_colorconverter_t *s
     self->transparent_color = NO_TRANSPARENT_COLOR;
     self->input_colorspace = input_colorspace;
     self->output_colorspace.depth = 16;
+    self->span_cache_colorspace = NULL;
+    self->span_cache_valid = 0;
 }
 
 uint16_t displayio_colorconverter_compute_rgb565(uint32_t color_rgb888) {
@@ -360,6 +362,151 @@ void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _d
 }
 
 
+// displayio_convert_color() gives an opaque result for every pixel in these
+// colorspaces. The others can drop pixels, which a span has no way to report.
+static bool always_opaque(const _displayio_colorspace_t *colorspace) {
+    return colorspace->depth == 32 || colorspace->depth == 16 || colorspace->depth == 8 ||
+           colorspace->depth == 4 || colorspace->tricolor || (colorspace->grayscale && colorspace->depth <= 8);
+}
+
+bool displayio_colorconverter_can_convert_span(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace) {
+    return !self->dither && always_opaque(colorspace);
+}
+
+bool displayio_colorconverter_is_transparent(displayio_colorconverter_t *self, uint32_t input_pixel) {
+    return self->transparent_color == input_pixel;
+}
+
+// RGB888 to RGB565 without any per pixel branches so that the compiler can
+// vectorize it.
+static void convert_span_rgb888_to_rgb565(uint32_t *pixels, size_t count, bool swap) {
+    if (swap) {
+        for (size_t i = 0; i < count; i++) {
+            uint32_t p = pixels[i];
+            uint32_t packed = ((p >> 8) & 0xf800) | ((p >> 5) & 0x07e0) | ((p >> 3) & 0x001f);
+            pixels[i] = ((packed >> 8) | (packed << 8)) & 0xffff;
+        }
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            uint32_t p = pixels[i];
+            pixels[i] = ((p >> 8) & 0xf800) | ((p >> 5) & 0x07e0) | ((p >> 3) & 0x001f);
+        }
+    }
+}
+
+static void convert_span_swap_bytes(uint32_t *pixels, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint32_t p = pixels[i];
+        pixels[i] = ((p >> 8) & 0xff) | ((p << 8) & 0xff00);
+    }
+}
+
+// Converts a 16 bit input pixel straight to RGB565. This matches going through
+// RGB888 because the extra low bits added by the expansion are dropped again.
+static inline uint32_t convert_16bit_to_rgb565(uint8_t input_colorspace, uint32_t p) {
+    switch (input_colorspace) {
+        case DISPLAYIO_COLORSPACE_RGB565_SWAPPED:
+            p = __builtin_bswap16(p);
+            MP_FALLTHROUGH;
+        case DISPLAYIO_COLORSPACE_RGB565:
+            return p & 0xffff;
+        case DISPLAYIO_COLORSPACE_BGR565_SWAPPED:
+            p = __builtin_bswap16(p);
+            MP_FALLTHROUGH;
+        case DISPLAYIO_COLORSPACE_BGR565:
+            return ((p & 0x1f) << 11) | (p & 0x07e0) | ((p >> 11) & 0x1f);
+        case DISPLAYIO_COLORSPACE_RGB555_SWAPPED:
+            p = __builtin_bswap16(p);
+            MP_FALLTHROUGH;
+        case DISPLAYIO_COLORSPACE_RGB555:
+            return ((p & 0x7c00) << 1) | ((p & 0x03e0) << 1) | (p & 0x1f);
+        case DISPLAYIO_COLORSPACE_BGR555_SWAPPED:
+            p = __builtin_bswap16(p);
+            MP_FALLTHROUGH;
+        case DISPLAYIO_COLORSPACE_BGR555:
+            return ((p & 0x1f) << 11) | ((p & 0x03e0) << 1) | ((p >> 10) & 0x1f);
+        case DISPLAYIO_COLORSPACE_L8:
+        default: {
+            uint32_t l8 = p & 0xff;
+            return ((l8 >> 3) << 11) | ((l8 >> 2) << 5) | (l8 >> 3);
+        }
+    }
+}
+
+static void convert_span_to_rgb565(uint8_t input_colorspace, uint32_t *pixels, size_t count, bool swap) {
+    switch (input_colorspace) {
+        case DISPLAYIO_COLORSPACE_RGB888:
+            convert_span_rgb888_to_rgb565(pixels, count, swap);
+            return;
+        case DISPLAYIO_COLORSPACE_RGB565:
+            if (swap) {
+                convert_span_swap_bytes(pixels, count);
+            } else {
+                for (size_t i = 0; i < count; i++) {
+                    pixels[i] &= 0xffff;
+                }
+            }
+            return;
+        case DISPLAYIO_COLORSPACE_RGB565_SWAPPED:
+            if (swap) {
+                for (size_t i = 0; i < count; i++) {
+                    pixels[i] &= 0xffff;
+                }
+            } else {
+                convert_span_swap_bytes(pixels, count);
+            }
+            return;
+        default:
+            break;
+    }
+    for (size_t i = 0; i < count; i++) {
+        pixels[i] = convert_16bit_to_rgb565(input_colorspace, pixels[i]);
+    }
+    if (swap) {
+        convert_span_swap_bytes(pixels, count);
+    }
+}
+
+static inline size_t span_cache_index(uint32_t pixel) {
+    return (pixel ^ (pixel >> 4) ^ (pixel >> 11) ^ (pixel >> 19)) % DISPLAYIO_COLORCONVERTER_SPAN_CACHE_SIZE;
+}
+
+void displayio_colorconverter_convert_span(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, uint32_t *pixels, size_t count) {
+    if (colorspace->depth == 16) {
+        convert_span_to_rgb565(self->input_colorspace, pixels, count, colorspace->reverse_bytes_in_word);
+        return;
+    }
+    if (colorspace->depth == 32 && self->input_colorspace == DISPLAYIO_COLORSPACE_RGB888) {
+        return;
+    }
+
+    // Everything else is a per pixel computation (luma, hue, etc.) so remember
+    // recent results. Images tend to have runs and a limited set of colors.
+    if (self->span_cache_colorspace != colorspace) {
+        self->span_cache_colorspace = colorspace;
+        self->span_cache_valid = 0;
+    }
+    displayio_input_pixel_t input_pixel;
+    input_pixel.x = input_pixel.y = input_pixel.tile = input_pixel.tile_x = input_pixel.tile_y = 0;
+    displayio_output_pixel_t output_pixel;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t pixel = pixels[i];
+        size_t index = span_cache_index(pixel);
+        if ((self->span_cache_valid & (1 << index)) != 0 && self->span_cache_input[index] == pixel) {
+            pixels[i] = self->span_cache_output[index];
+            continue;
+        }
+        input_pixel.pixel = displayio_colorconverter_convert_pixel(self->input_colorspace, pixel);
+        output_pixel.pixel = 0;
+        displayio_convert_color(colorspace, false, &input_pixel, &output_pixel);
+        self->span_cache_input[index] = pixel;
+        self->span_cache_output[index] = output_pixel.pixel;
+        self->span_cache_valid |= 1 << index;
+        pixels[i] = output_pixel.pixel;
+    }
+}
+
+
 
 // Currently no refresh logic is needed for a ColorConverter.
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self) {
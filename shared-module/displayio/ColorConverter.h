@@ -33,6 +33,8 @@
 #include "py/obj.h"
 #include "shared-module/displayio/Palette.h"
 
+#define DISPLAYIO_COLORCONVERTER_SPAN_CACHE_SIZE (16)
+
 typedef struct displayio_colorconverter {
     mp_obj_base_t base;
     bool dither;
@@ -44,12 +46,28 @@ typedef struct displayio_colorconverter {
     const _displayio_colorspace_t *cached_colorspace;
     uint32_t cached_input_pixel;
     uint32_t cached_output_color;
+
+    // Small direct mapped cache of span conversions for output colorspaces that
+    // need more than bit shuffling (grayscale, tricolor, sevencolor, etc).
+    const _displayio_colorspace_t *span_cache_colorspace;
+    uint16_t span_cache_valid;
+    uint32_t span_cache_input[DISPLAYIO_COLORCONVERTER_SPAN_CACHE_SIZE];
+    uint32_t span_cache_output[DISPLAYIO_COLORCONVERTER_SPAN_CACHE_SIZE];
 } displayio_colorconverter_t;
 
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self);
 void displayio_colorconverter_finish_refresh(displayio_colorconverter_t *self);
 void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color);
 
+// Span conversion converts `count` input pixels in place. Transparency is not
+// handled so callers must skip pixels where displayio_colorconverter_is_transparent()
+// is true. It is only usable when displayio_colorconverter_can_convert_span() is
+// true: dithering needs each pixel's coordinates, and some output colorspaces
+// leave pixels transparent.
+bool displayio_colorconverter_can_convert_span(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace);
+bool displayio_colorconverter_is_transparent(displayio_colorconverter_t *self, uint32_t input_pixel);
+void displayio_colorconverter_convert_span(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, uint32_t *pixels, size_t count);
+
 uint32_t displayio_colorconverter_dither_noise_1(uint32_t n);
 uint32_t displayio_colorconverter_dither_noise_2(uint32_t x, uint32_t y);
 
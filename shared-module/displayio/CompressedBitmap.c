@@ -0,0 +1,215 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/displayio/CompressedBitmap.h"
+
+#include <string.h>
+
+#include "py/runtime.h"
+
+// Longest packet; the count is stored in the low 7 bits of the header, minus one.
+#define MAX_PACKET (128)
+#define RUN_FLAG (0x80)
+
+// Length of the run of identical values starting at x, at most MAX_PACKET
+static uint16_t run_length(displayio_bitmap_t *source, uint16_t x, uint16_t y) {
+    uint32_t value = common_hal_displayio_bitmap_get_pixel(source, x, y);
+    uint16_t n = 1;
+    while (n < MAX_PACKET && x + n < source->width &&
+           common_hal_displayio_bitmap_get_pixel(source, x + n, y) == value) {
+        n++;
+    }
+    return n;
+}
+
+static void put_value(uint8_t *dest, uint32_t value, uint8_t bytes_per_value) {
+    for (uint8_t i = 0; i < bytes_per_value; i++) {
+        dest[i] = value & 0xff;
+        value >>= 8;
+    }
+}
+
+static uint32_t get_value(const uint8_t *src, uint8_t bytes_per_value) {
+    switch (bytes_per_value) {
+        case 1:
+            return src[0];
+        case 2:
+            return src[0] | src[1] << 8;
+        default:
+            return src[0] | src[1] << 8 | src[2] << 16 | (uint32_t)src[3] << 24;
+    }
+}
+
+// Encode one row. If dest is NULL only the encoded length is computed.
+static size_t encode_row(displayio_bitmap_t *source, uint16_t y, uint8_t bytes_per_value, uint8_t *dest) {
+    // A run only pays for itself once it saves at least one header byte.
+    uint16_t min_run = bytes_per_value == 1 ? 3 : 2;
+    size_t len = 0;
+    uint16_t x = 0;
+    while (x < source->width) {
+        uint16_t n = run_length(source, x, y);
+        if (n >= min_run) {
+            if (dest) {
+                dest[len] = RUN_FLAG | (n - 1);
+                put_value(dest + len + 1, common_hal_displayio_bitmap_get_pixel(source, x, y), bytes_per_value);
+            }
+            len += 1 + bytes_per_value;
+            x += n;
+            continue;
+        }
+        // Gather literals until the next worthwhile run.
+        uint16_t start = x;
+        while (x < source->width && x - start < MAX_PACKET) {
+            n = run_length(source, x, y);
+            if (n >= min_run) {
+                break;
+            }
+            x += MIN(n, MAX_PACKET - (x - start));
+        }
+        uint16_t count = x - start;
+        if (dest) {
+            dest[len] = count - 1;
+            for (uint16_t i = 0; i < count; i++) {
+                put_value(dest + len + 1 + i * bytes_per_value,
+                    common_hal_displayio_bitmap_get_pixel(source, start + i, y), bytes_per_value);
+            }
+        }
+        len += 1 + count * bytes_per_value;
+    }
+    return len;
+}
+
+void common_hal_displayio_compressedbitmap_construct(displayio_compressedbitmap_t *self, displayio_bitmap_t *source) {
+    self->width = source->width;
+    self->height = source->height;
+    self->bits_per_value = source->bits_per_value;
+    self->bytes_per_value = (source->bits_per_value + 7) / 8;
+
+    self->row_offsets = m_malloc((self->height + 1) * sizeof(uint32_t));
+    uint32_t total = 0;
+    for (uint16_t y = 0; y < self->height; y++) {
+        self->row_offsets[y] = total;
+        total += encode_row(source, y, self->bytes_per_value, NULL);
+    }
+    self->row_offsets[self->height] = total;
+
+    self->data = m_malloc(total ? total : 1);
+    for (uint16_t y = 0; y < self->height; y++) {
+        encode_row(source, y, self->bytes_per_value, self->data + self->row_offsets[y]);
+    }
+
+    self->cursor_y = -1;
+}
+
+uint16_t common_hal_displayio_compressedbitmap_get_height(displayio_compressedbitmap_t *self) {
+    return self->height;
+}
+
+uint16_t common_hal_displayio_compressedbitmap_get_width(displayio_compressedbitmap_t *self) {
+    return self->width;
+}
+
+uint32_t common_hal_displayio_compressedbitmap_get_bits_per_value(displayio_compressedbitmap_t *self) {
+    return self->bits_per_value;
+}
+
+uint32_t common_hal_displayio_compressedbitmap_get_compressed_size(displayio_compressedbitmap_t *self) {
+    return self->row_offsets[self->height] + (self->height + 1) * sizeof(uint32_t);
+}
+
+static inline uint16_t packet_count(uint8_t header) {
+    return (header & ~RUN_FLAG) + 1;
+}
+
+static inline uint32_t packet_size(uint8_t header, uint8_t bytes_per_value) {
+    return 1 + ((header & RUN_FLAG) ? 1 : packet_count(header)) * bytes_per_value;
+}
+
+void displayio_compressedbitmap_read_span(displayio_compressedbitmap_t *self, int16_t x, int16_t y, uint16_t count, uint32_t *out) {
+    if (count == 0) {
+        return;
+    }
+    if (y < 0 || y >= self->height || x < 0 || x + count > self->width) {
+        memset(out, 0, count * sizeof(uint32_t));
+        return;
+    }
+
+    // Resume from the last packet read when moving forward along the same
+    // row, otherwise start from the row index.
+    uint32_t offset;
+    uint16_t packet_x;
+    if (y == self->cursor_y && x >= self->cursor_x) {
+        offset = self->cursor_offset;
+        packet_x = self->cursor_x;
+    } else {
+        offset = self->row_offsets[y];
+        packet_x = 0;
+    }
+
+    uint8_t bytes_per_value = self->bytes_per_value;
+    const uint8_t *data = self->data;
+    while (x >= packet_x + packet_count(data[offset])) {
+        packet_x += packet_count(data[offset]);
+        offset += packet_size(data[offset], bytes_per_value);
+    }
+
+    while (true) {
+        uint8_t header = data[offset];
+        uint16_t n = packet_count(header);
+        uint16_t skip = x - packet_x;
+        uint16_t take = MIN(n - skip, count);
+        const uint8_t *values = data + offset + 1;
+        if (header & RUN_FLAG) {
+            uint32_t value = get_value(values, bytes_per_value);
+            for (uint16_t i = 0; i < take; i++) {
+                *out++ = value;
+            }
+        } else {
+            values += skip * bytes_per_value;
+            for (uint16_t i = 0; i < take; i++, values += bytes_per_value) {
+                *out++ = get_value(values, bytes_per_value);
+            }
+        }
+        x += take;
+        count -= take;
+        if (count == 0) {
+            break;
+        }
+        packet_x += n;
+        offset += packet_size(header, bytes_per_value);
+    }
+
+    self->cursor_y = y;
+    self->cursor_x = packet_x;
+    self->cursor_offset = offset;
+}
+
+uint32_t common_hal_displayio_compressedbitmap_get_pixel(displayio_compressedbitmap_t *self, int16_t x, int16_t y) {
+    uint32_t value;
+    displayio_compressedbitmap_read_span(self, x, y, 1, &value);
+    return value;
+}
@@ -0,0 +1,58 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_COMPRESSEDBITMAP_H
+#define MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_COMPRESSEDBITMAP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/obj.h"
+
+// Each row is stored as a sequence of packets. A packet starts with a header
+// byte: if the top bit is set, the next value is repeated (header & 0x7f) + 1
+// times; otherwise header + 1 literal values follow. Values are stored little
+// endian in bytes_per_value bytes. row_offsets[y] is the offset of the first
+// packet of row y, and row_offsets[height] is the total length of data.
+typedef struct {
+    mp_obj_base_t base;
+    uint16_t width;
+    uint16_t height;
+    uint8_t bits_per_value;
+    uint8_t bytes_per_value;
+    uint32_t *row_offsets;
+    uint8_t *data;
+    // Decoding position of the most recent read. Displays are refreshed
+    // row by row, so reads usually continue where the previous one stopped.
+    int32_t cursor_y;
+    uint16_t cursor_x; // x of the first pixel in the packet at cursor_offset
+    uint32_t cursor_offset;
+} displayio_compressedbitmap_t;
+
+// Decode count consecutive values from row y, starting at x, into out.
+void displayio_compressedbitmap_read_span(displayio_compressedbitmap_t *self, int16_t x, int16_t y, uint16_t count, uint32_t *out);
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_COMPRESSEDBITMAP_H
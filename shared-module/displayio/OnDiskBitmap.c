@@ -39,7 +39,7 @@ static uint32_t read_word(uint16_t *bmp_header, uint16_t index) {
     return bmp_header[index] | bmp_header[index + 1] << 16;
 }
 
-void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self, pyb_file_obj_t *file) {
+void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self, pyb_file_obj_t *file, uint16_t cache_rows) {
     // Load the wave
     self->file = file;
     uint16_t bmp_header[69];
@@ -110,7 +110,7 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
             for (uint16_t i = 0; i < number_of_colors; i++) {
                 common_hal_displayio_palette_set_color(palette, i, palette_data[i]);
             }
-            m_free(palette_data);
+            m_del(uint8_t, palette_data, palette_size);
         } else {
             common_hal_displayio_palette_set_color(palette, 0, 0x0);
             common_hal_displayio_palette_set_color(palette, 1, 0xffffff);
@@ -141,6 +141,64 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
         self->stride = (bit_stride / 8);
     }
 
+    self->cache_rows = MIN(cache_rows, self->height);
+    self->cache = NULL;
+    if (self->cache_rows > 0) {
+        self->cache = m_malloc(self->cache_rows * self->stride);
+    }
+    self->cache_row_count = 0;
+    self->cache_first_row = 0;
+    self->cache_hits = 0;
+    self->cache_misses = 0;
+}
+
+// Load a block of whole rows containing y into the cache. Displays are
+// refreshed in row order, so the block starts at y and extends down the
+// image, unless y is just above what is cached, in which case the refresh is
+// moving up the image and the block ends at y. Rows are stored bottom up in
+// the file, so either way the block is one contiguous read.
+static bool load_cache(displayio_ondiskbitmap_t *self, int16_t y) {
+    int16_t first = y;
+    if (self->cache_row_count > 0 && y < self->cache_first_row) {
+        first = MAX(0, y - self->cache_rows + 1);
+    }
+    uint16_t count = MIN(self->cache_rows, self->height - first);
+    uint32_t location = self->data_offset + (self->height - first - count) * self->stride;
+    uint32_t length = count * self->stride;
+
+    self->cache_row_count = 0;
+    UINT bytes_read;
+    if (f_lseek(&self->file->fp, location) != FR_OK ||
+        f_read(&self->file->fp, self->cache, length, &bytes_read) != FR_OK ||
+        bytes_read != length) {
+        return false;
+    }
+    self->cache_first_row = first;
+    self->cache_row_count = count;
+    return true;
+}
+
+// Copy the bytes_per_pixel bytes holding pixel (x, y) to pixel_data.
+static bool read_pixel_data(displayio_ondiskbitmap_t *self, uint32_t offset_in_row, int16_t y,
+    uint8_t bytes_per_pixel, uint32_t *pixel_data) {
+    if (self->cache == NULL) {
+        uint32_t location = self->data_offset + (self->height - y - 1) * self->stride + offset_in_row;
+        f_lseek(&self->file->fp, location);
+        UINT bytes_read;
+        return f_read(&self->file->fp, pixel_data, bytes_per_pixel, &bytes_read) == FR_OK;
+    }
+
+    if (y >= self->cache_first_row && y < self->cache_first_row + self->cache_row_count) {
+        self->cache_hits++;
+    } else {
+        self->cache_misses++;
+        if (!load_cache(self, y)) {
+            return false;
+        }
+    }
+    uint16_t cache_row = self->cache_first_row + self->cache_row_count - 1 - y;
+    memcpy(pixel_data, self->cache + cache_row * self->stride + offset_in_row, bytes_per_pixel);
+    return true;
 }
 
 
@@ -150,20 +208,16 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *s
         return 0;
     }
 
-    uint32_t location;
+    uint32_t offset_in_row;
     uint8_t bytes_per_pixel = (self->bits_per_pixel / 8)  ? (self->bits_per_pixel / 8) : 1;
     uint8_t pixels_per_byte = 8 / self->bits_per_pixel;
     if (pixels_per_byte == 0) {
-        location = self->data_offset + (self->height - y - 1) * self->stride + x * bytes_per_pixel;
+        offset_in_row = x * bytes_per_pixel;
     } else {
-        location = self->data_offset + (self->height - y - 1) * self->stride + x / pixels_per_byte;
+        offset_in_row = x / pixels_per_byte;
     }
-    // We don't cache here because the underlying FS caches sectors.
-    f_lseek(&self->file->fp, location);
-    UINT bytes_read;
     uint32_t pixel_data = 0;
-    uint32_t result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
-    if (result == FR_OK) {
+    if (read_pixel_data(self, offset_in_row, y, bytes_per_pixel, &pixel_data)) {
         uint32_t tmp = 0;
         uint8_t red;
         uint8_t green;
@@ -202,6 +256,14 @@ uint16_t common_hal_displayio_ondiskbitmap_get_width(displayio_ondiskbitmap_t *s
     return self->width;
 }
 
+uint32_t common_hal_displayio_ondiskbitmap_get_cache_hits(displayio_ondiskbitmap_t *self) {
+    return self->cache_hits;
+}
+
+uint32_t common_hal_displayio_ondiskbitmap_get_cache_misses(displayio_ondiskbitmap_t *self) {
+    return self->cache_misses;
+}
+
 mp_obj_t common_hal_displayio_ondiskbitmap_get_pixel_shader(displayio_ondiskbitmap_t *self) {
     return MP_OBJ_FROM_PTR(self->pixel_shader_base);
 }
@@ -49,6 +49,14 @@ typedef struct {
         struct displayio_palette *palette;
         struct displayio_colorconverter *colorconverter;
     };
+    // Rows [cache_first_row, cache_first_row + cache_row_count) are held in
+    // cache, in file order (bottom row first).
+    uint8_t *cache;
+    uint16_t cache_rows;
+    uint16_t cache_row_count;
+    int16_t cache_first_row;
+    uint32_t cache_hits;
+    uint32_t cache_misses;
     bool bitfield_compressed;
     uint8_t bits_per_pixel;
 } displayio_ondiskbitmap_t;
@@ -29,6 +29,7 @@
 #include "py/runtime.h"
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/ColorConverter.h"
+#include "shared-bindings/displayio/CompressedBitmap.h"
 #include "shared-bindings/displayio/OnDiskBitmap.h"
 #include "shared-bindings/displayio/Palette.h"
 
@@ -381,6 +382,41 @@ void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint
     self->full_change = true;
 }
 
+// Number of pixels converted at once by a ColorConverter pixel shader.
+#define TILEGRID_SPAN_SIZE (32)
+
+// Stores an opaque output pixel into the buffer and marks it in the mask.
+static void _write_pixel(const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer, int16_t offset, uint32_t pixel) {
+    mask[offset / 32] |= 1 << (offset % 32);
+    if (colorspace->depth == 16) {
+        *(((uint16_t *)buffer) + offset) = pixel;
+    } else if (colorspace->depth == 32) {
+        *(((uint32_t *)buffer) + offset) = pixel;
+    } else if (colorspace->depth == 8) {
+        *(((uint8_t *)buffer) + offset) = pixel;
+    } else if (colorspace->depth < 8) {
+        uint8_t pixels_per_byte = 8 / colorspace->depth;
+        // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+        if (!colorspace->pixels_in_byte_share_row) {
+            uint16_t width = displayio_area_width(area);
+            uint16_t row = offset / width;
+            uint16_t col = offset % width;
+            // Dividing by pixels_per_byte does truncated division even if we multiply it back out.
+            offset = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * width + row % pixels_per_byte;
+            // Also useful for validating that the bitpacking worked correctly.
+            // if (offset > displayio_area_size(area)) {
+            //     asm("bkpt");
+            // }
+        }
+        uint8_t shift = (offset % pixels_per_byte) * colorspace->depth;
+        if (colorspace->reverse_pixels_in_byte) {
+            // Reverse the shift by subtracting it from the leftmost shift.
+            shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+        }
+        ((uint8_t *)buffer)[offset / pixels_per_byte] |= pixel << shift;
+    }
+}
+
 bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     const _displayio_colorspace_t *colorspace, const displayio_area_t *area,
     uint32_t *mask, uint32_t *buffer) {
@@ -468,11 +504,29 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
         y_shift = temp_shift;
     }
 
-    uint8_t pixels_per_byte = 8 / colorspace->depth;
-
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
 
+    // ColorConverters without dithering convert a batch of pixels at once so
+    // the colorspace work happens once per batch instead of once per pixel.
+    displayio_colorconverter_t *span_converter = NULL;
+    if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type) &&
+        displayio_colorconverter_can_convert_span(self->pixel_shader, colorspace)) {
+        span_converter = self->pixel_shader;
+    }
+    uint32_t span_pixels[TILEGRID_SPAN_SIZE];
+    int16_t span_offsets[TILEGRID_SPAN_SIZE];
+    size_t span_length = 0;
+
+    // CompressedBitmap rows are decoded a chunk at a time. The chunks are
+    // aligned to the tile so that every pixel of a chunk is read before moving
+    // on, whichever way the tile is flipped or transposed.
+    bool compressed = mp_obj_is_type(self->bitmap, &displayio_compressedbitmap_type);
+    uint32_t row_values[TILEGRID_SPAN_SIZE];
+    int16_t row_values_x = 0;
+    int16_t row_values_y = -1;
+    uint16_t row_values_count = 0;
+
     for (input_pixel.y = start_y; input_pixel.y < end_y; ++input_pixel.y) {
         int16_t row_start = start + (input_pixel.y - start_y + y_shift) * y_stride; // in pixels
         int16_t local_y = input_pixel.y / self->absolute_transform->scale;
@@ -502,10 +556,39 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
             // buffer because most bitmaps are row associated.
             if (mp_obj_is_type(self->bitmap, &displayio_bitmap_type)) {
                 input_pixel.pixel = common_hal_displayio_bitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
+            } else if (compressed) {
+                if (input_pixel.tile_y != row_values_y ||
+                    input_pixel.tile_x < row_values_x ||
+                    input_pixel.tile_x >= row_values_x + row_values_count) {
+                    int16_t tile_left = (input_pixel.tile % self->bitmap_width_in_tiles) * self->tile_width;
+                    row_values_x = input_pixel.tile_x - (input_pixel.tile_x - tile_left) % TILEGRID_SPAN_SIZE;
+                    row_values_y = input_pixel.tile_y;
+                    row_values_count = MIN(TILEGRID_SPAN_SIZE, tile_left + self->tile_width - row_values_x);
+                    displayio_compressedbitmap_read_span(self->bitmap, row_values_x, row_values_y, row_values_count, row_values);
+                }
+                input_pixel.pixel = row_values[input_pixel.tile_x - row_values_x];
             } else if (mp_obj_is_type(self->bitmap, &displayio_ondiskbitmap_type)) {
                 input_pixel.pixel = common_hal_displayio_ondiskbitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
             }
 
+            if (span_converter != NULL) {
+                if (displayio_colorconverter_is_transparent(span_converter, input_pixel.pixel)) {
+                    full_coverage = false;
+                    continue;
+                }
+                span_pixels[span_length] = input_pixel.pixel;
+                span_offsets[span_length] = offset;
+                span_length++;
+                if (span_length == TILEGRID_SPAN_SIZE) {
+                    displayio_colorconverter_convert_span(span_converter, colorspace, span_pixels, span_length);
+                    for (size_t i = 0; i < span_length; i++) {
+                        _write_pixel(colorspace, area, mask, buffer, span_offsets[i], span_pixels[i]);
+                    }
+                    span_length = 0;
+                }
+                continue;
+            }
+
             output_pixel.opaque = true;
             if (self->pixel_shader == mp_const_none) {
                 output_pixel.pixel = input_pixel.pixel;
@@ -518,36 +601,16 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
                 // A pixel is transparent so we haven't fully covered the area ourselves.
                 full_coverage = false;
             } else {
-                mask[offset / 32] |= 1 << (offset % 32);
-                if (colorspace->depth == 16) {
-                    *(((uint16_t *)buffer) + offset) = output_pixel.pixel;
-                } else if (colorspace->depth == 32) {
-                    *(((uint32_t *)buffer) + offset) = output_pixel.pixel;
-                } else if (colorspace->depth == 8) {
-                    *(((uint8_t *)buffer) + offset) = output_pixel.pixel;
-                } else if (colorspace->depth < 8) {
-                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
-                    if (!colorspace->pixels_in_byte_share_row) {
-                        uint16_t width = displayio_area_width(area);
-                        uint16_t row = offset / width;
-                        uint16_t col = offset % width;
-                        // Dividing by pixels_per_byte does truncated division even if we multiply it back out.
-                        offset = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * width + row % pixels_per_byte;
-                        // Also useful for validating that the bitpacking worked correctly.
-                        // if (offset > displayio_area_size(area)) {
-                        //     asm("bkpt");
-                        // }
-                    }
-                    uint8_t shift = (offset % pixels_per_byte) * colorspace->depth;
-                    if (colorspace->reverse_pixels_in_byte) {
-                        // Reverse the shift by subtracting it from the leftmost shift.
-                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
-                    }
-                    ((uint8_t *)buffer)[offset / pixels_per_byte] |= output_pixel.pixel << shift;
-                }
+                _write_pixel(colorspace, area, mask, buffer, offset, output_pixel.pixel);
             }
         }
     }
+    if (span_length > 0) {
+        displayio_colorconverter_convert_span(span_converter, colorspace, span_pixels, span_length);
+        for (size_t i = 0; i < span_length; i++) {
+            _write_pixel(colorspace, area, mask, buffer, span_offsets[i], span_pixels[i]);
+        }
+    }
     return full_coverage;
 }
 
@@ -570,6 +633,8 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     }
     if (mp_obj_is_type(self->bitmap, &displayio_bitmap_type)) {
         displayio_bitmap_finish_refresh(self->bitmap);
+    } else if (mp_obj_is_type(self->bitmap, &displayio_compressedbitmap_type)) {
+        // CompressedBitmap is read-only so never changes.
     } else if (mp_obj_is_type(self->bitmap, &displayio_ondiskbitmap_type)) {
         // OnDiskBitmap changes will trigger a complete reload so no need to
         // track changes.
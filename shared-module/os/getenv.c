@@ -281,18 +281,161 @@ STATIC mp_int_t read_value(file_arg *active_file, vstr_t *buf, bool *quoted) {
     }
 }
 
+// Scan forward from the start of a line for the first definition of key.
+STATIC os_getenv_err_t find_key(file_arg *active_file, const char *key, vstr_t *buf, bool *quoted) {
+    while (!is_eof(active_file)) {
+        if (key_matches(active_file, key)) {
+            return read_value(active_file, buf, quoted);
+        }
+    }
+    return GETENV_ERR_NOT_FOUND;
+}
+
+#if CIRCUITPY_OS_GETENV_INDEX_SIZE
+// settings.toml is read on every os.getenv() call and by the supervisor at
+// startup, one byte at a time. Remember where each key's line starts so that a
+// lookup can seek straight to it instead of scanning from the top of the file.
+// The index describes one version of one file: any write to a FAT filesystem
+// or a different file at GETENV_PATH causes it to be rebuilt.
+typedef struct {
+    uint16_t hash;
+    uint16_t offset;
+} getenv_index_entry_t;
+
+STATIC struct {
+    FATFS *fs;
+    WORD mount_id;
+    DWORD sclust;
+    FSIZE_t size;
+    uint32_t write_count;
+    // Keys from here on are not in the index. Only meaningful if !complete.
+    FSIZE_t resume;
+    uint16_t len;
+    bool valid;
+    bool complete;
+    getenv_index_entry_t entries[CIRCUITPY_OS_GETENV_INDEX_SIZE];
+} getenv_index;
+
+STATIC uint16_t hash_byte(uint16_t hash, uint8_t character) {
+    return (hash * 33) ^ character;
+}
+
+STATIC uint16_t hash_key(const char *key) {
+    uint16_t hash = 5381;
+    while (*key) {
+        hash = hash_byte(hash, *key++);
+    }
+    return hash;
+}
+
+// Keys containing whitespace or "=" are split differently by the indexer
+// than by key_matches(), so they are always looked up by scanning.
+STATIC bool key_indexable(const char *key) {
+    for (; *key; key++) {
+        if (*key == '=' || unichar_isspace(*key)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+STATIC bool index_is_current(file_arg *active_file) {
+    return getenv_index.valid &&
+           getenv_index.fs == active_file->obj.fs &&
+           getenv_index.mount_id == active_file->obj.id &&
+           getenv_index.sclust == active_file->obj.sclust &&
+           getenv_index.size == f_size(active_file) &&
+           getenv_index.write_count == vfs_fat_write_count;
+}
+
+// Record the offset of every key before the first table, reading the file once
+// from the start. Returns false if the file could not be read.
+STATIC bool index_file(file_arg *active_file) {
+    getenv_index.valid = false;
+    getenv_index.complete = false;
+    getenv_index.len = 0;
+    while (true) {
+        FSIZE_t offset = f_tell(active_file);
+        uint8_t character = consume_whitespace(active_file);
+        if (character == '[' || character == 0) {
+            getenv_index.complete = true;
+            break;
+        }
+        if (character == '\n') {
+            continue;
+        }
+        uint16_t hash = 5381;
+        while (character != '=' && character != 0 && !unichar_isspace(character)) {
+            hash = hash_byte(hash, character);
+            character = get_next_byte(active_file);
+        }
+        if (character != '\n' && unichar_isspace(character)) {
+            character = consume_whitespace(active_file);
+        }
+        if (character == '=') {
+            if (getenv_index.len == CIRCUITPY_OS_GETENV_INDEX_SIZE || offset > UINT16_MAX) {
+                getenv_index.resume = offset;
+                break;
+            }
+            getenv_index.entries[getenv_index.len++] = (getenv_index_entry_t) {
+                .hash = hash, .offset = offset
+            };
+        }
+        if (character != '\n') {
+            next_line(active_file);
+        }
+    }
+    if (f_error(active_file)) {
+        return false;
+    }
+    getenv_index.fs = active_file->obj.fs;
+    getenv_index.mount_id = active_file->obj.id;
+    getenv_index.sclust = active_file->obj.sclust;
+    getenv_index.size = f_size(active_file);
+    getenv_index.write_count = vfs_fat_write_count;
+    getenv_index.valid = true;
+    return true;
+}
+
+STATIC os_getenv_err_t find_key_indexed(file_arg *active_file, const char *key, vstr_t *buf, bool *quoted) {
+    if (!index_is_current(active_file) && !index_file(active_file)) {
+        f_lseek(active_file, 0);
+        return find_key(active_file, key, buf, quoted);
+    }
+    // Candidates are in file order, so the first one that really matches is
+    // the one a full scan would have found.
+    uint16_t hash = hash_key(key);
+    for (size_t i = 0; i < getenv_index.len; i++) {
+        if (getenv_index.entries[i].hash != hash) {
+            continue;
+        }
+        f_lseek(active_file, getenv_index.entries[i].offset);
+        if (key_matches(active_file, key)) {
+            return read_value(active_file, buf, quoted);
+        }
+    }
+    if (getenv_index.complete) {
+        return GETENV_ERR_NOT_FOUND;
+    }
+    f_lseek(active_file, getenv_index.resume);
+    return find_key(active_file, key, buf, quoted);
+}
+#endif
+
 STATIC os_getenv_err_t os_getenv_vstr(const char *path, const char *key, vstr_t *buf, bool *quoted) {
     file_arg active_file;
     if (!open_file(path, &active_file)) {
         return GETENV_ERR_OPEN;
     }
 
-    os_getenv_err_t result = GETENV_ERR_NOT_FOUND;
-    while (!is_eof(&active_file)) {
-        if (key_matches(&active_file, key)) {
-            result = read_value(&active_file, buf, quoted);
-            break;
-        }
+    os_getenv_err_t result;
+    #if CIRCUITPY_OS_GETENV_INDEX_SIZE
+    if (strcmp(path, GETENV_PATH) == 0 && key_indexable(key)) {
+        result = find_key_indexed(&active_file, key, buf, quoted);
+    } else
+    #endif
+    {
+        result = find_key(&active_file, key, buf, quoted);
     }
     close_file(&active_file);
     return result;
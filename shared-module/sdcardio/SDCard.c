@@ -93,7 +93,8 @@ static uint8_t CRC7(const uint8_t *data, uint8_t n) {
     return (crc << 1) | 1;
 }
 
-#define READY_TIMEOUT_NS (300 * 1000 * 1000) // 300ms
+// Cards may stay busy for up to 500ms programming a block.
+#define READY_TIMEOUT_NS (500 * 1000 * 1000) // 500ms
 STATIC int wait_for_ready(sdcardio_sdcard_obj_t *self) {
     uint64_t deadline = common_hal_time_monotonic_ns() + READY_TIMEOUT_NS;
     while (common_hal_time_monotonic_ns() < deadline) {
@@ -129,6 +130,11 @@ STATIC int exit_cmd25(sdcardio_sdcard_obj_t *self) {
     if (self->in_cmd25) {
         DEBUG_PRINT("exit cmd25\n");
         self->in_cmd25 = false;
+        // The last block written may still be being programmed.
+        int r = wait_for_ready(self);
+        if (r < 0) {
+            return r;
+        }
         return cmd_nodata(self, TOKEN_STOP_TRAN, 0);
     }
     return 0;
@@ -407,8 +413,14 @@ int common_hal_sdcardio_sdcard_readblocks(sdcardio_sdcard_obj_t *self, uint32_t
     return r;
 }
 
+// Returns as soon as the card has accepted the block. The card is then busy
+// programming it, which overlaps with whatever the caller does next; the next
+// command or block waits for it to finish.
 STATIC int _write(sdcardio_sdcard_obj_t *self, uint8_t token, void *buf, size_t size) {
-    wait_for_ready(self);
+    int r = wait_for_ready(self);
+    if (r < 0) {
+        return r;
+    }
 
     uint8_t cmd[2];
     cmd[0] = token;
@@ -443,11 +455,6 @@ STATIC int _write(sdcardio_sdcard_obj_t *self, uint8_t token, void *buf, size_t
         }
     }
 
-    // Wait for the write to finish
-    do {
-        common_hal_busio_spi_read(self->bus, cmd, 1, 0xff);
-    } while (cmd[0] == 0);
-
     // Success
     return 0;
 }
@@ -488,6 +495,10 @@ int common_hal_sdcardio_sdcard_sync(sdcardio_sdcard_obj_t *self) {
     common_hal_sdcardio_check_for_deinit(self);
     lock_and_configure_bus(self);
     int r = exit_cmd25(self);
+    if (r == 0) {
+        // Don't report the data as synced until the card has finished programming it.
+        r = wait_for_ready(self);
+    }
     extraclock_and_unlock_bus(self);
     return r;
 }
@@ -0,0 +1,283 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-module/spectrum/FFT.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "py/binary.h"
+#include "py/mperrno.h"
+#include "py/runtime.h"
+#include "shared-module/audiocore/__init__.h"
+
+// M_PI is not part of the math.h standard and may not be defined
+#define MP_PI MICROPY_FLOAT_CONST(3.14159265358979323846)
+
+// Before a stage, values below this can't overflow 16 bits in a radix-2
+// butterfly, which grows them by at most 1 + sqrt(2).
+#define HEADROOM (8192)
+
+void common_hal_spectrum_fft_construct(spectrum_fft_obj_t *self, uint16_t size, spectrum_window_t window) {
+    self->size = size;
+    self->log2_size = 0;
+    while ((1u << self->log2_size) < size) {
+        self->log2_size++;
+    }
+    self->window_type = window;
+    self->window = m_malloc(size * sizeof(int16_t));
+    self->twiddle = m_malloc(size * sizeof(int16_t));
+    self->re = m_malloc(size * sizeof(int16_t));
+    self->im = m_malloc(size * sizeof(int16_t));
+    self->float_twiddle = NULL;
+
+    for (size_t i = 0; i < size; i++) {
+        mp_float_t w = 1;
+        mp_float_t phase = 2 * MP_PI * i / size;
+        if (window == SPECTRUM_WINDOW_HANN) {
+            w = MICROPY_FLOAT_CONST(0.5) - MICROPY_FLOAT_CONST(0.5) * MICROPY_FLOAT_C_FUN(cos)(phase);
+        } else if (window == SPECTRUM_WINDOW_HAMMING) {
+            w = MICROPY_FLOAT_CONST(0.54) - MICROPY_FLOAT_CONST(0.46) * MICROPY_FLOAT_C_FUN(cos)(phase);
+        }
+        self->window[i] = (int16_t)MIN(w * 32768, 32767);
+    }
+    for (size_t k = 0; k < size / 2; k++) {
+        mp_float_t phase = 2 * MP_PI * k / size;
+        self->twiddle[2 * k] = (int16_t)MIN(MICROPY_FLOAT_C_FUN(cos)(phase) * 32768, 32767);
+        self->twiddle[2 * k + 1] = (int16_t)MIN(-MICROPY_FLOAT_C_FUN(sin)(phase) * 32768, 32767);
+    }
+}
+
+uint16_t common_hal_spectrum_fft_get_size(spectrum_fft_obj_t *self) {
+    return self->size;
+}
+
+spectrum_window_t common_hal_spectrum_fft_get_window(spectrum_fft_obj_t *self) {
+    return self->window_type;
+}
+
+static inline uint32_t bit_reverse(uint32_t i, uint8_t bits) {
+    uint32_t r = 0;
+    for (uint8_t b = 0; b < bits; b++) {
+        r = (r << 1) | (i & 1);
+        i >>= 1;
+    }
+    return r;
+}
+
+static inline uint32_t abs_or(int32_t a, int32_t b) {
+    return (uint32_t)(a < 0 ? -a : a) | (uint32_t)(b < 0 ? -b : b);
+}
+
+// Radix-2 decimation in time over the bit reversed input in re/im, with
+// block floating point: a stage only halves its outputs when the previous
+// stage left values large enough to overflow. Returns how many stages were
+// scaled, so the true result is re/im << the return value.
+static int fixed_fft(spectrum_fft_obj_t *self, uint32_t peak) {
+    int16_t *restrict re = self->re;
+    int16_t *restrict im = self->im;
+    const int16_t *twiddle = self->twiddle;
+    uint32_t size = self->size;
+    int exponent = 0;
+
+    for (uint32_t half = 1, step = size / 2; half < size; half *= 2, step /= 2) {
+        int shift = peak >= HEADROOM ? 1 : 0;
+        exponent += shift;
+        peak = 0;
+        for (uint32_t k = 0; k < half; k++) {
+            int32_t wr = twiddle[2 * k * step];
+            int32_t wi = twiddle[2 * k * step + 1];
+            for (uint32_t a = k; a < size; a += 2 * half) {
+                uint32_t b = a + half;
+                int32_t tr = (re[b] * wr - im[b] * wi) >> 15;
+                int32_t ti = (re[b] * wi + im[b] * wr) >> 15;
+                int32_t ar = re[a];
+                int32_t ai = im[a];
+                int32_t r0 = (ar + tr) >> shift, i0 = (ai + ti) >> shift;
+                int32_t r1 = (ar - tr) >> shift, i1 = (ai - ti) >> shift;
+                re[a] = r0;
+                im[a] = i0;
+                re[b] = r1;
+                im[b] = i1;
+                peak |= abs_or(r0, i0) | abs_or(r1, i1);
+            }
+        }
+    }
+    return exponent;
+}
+
+static uint32_t isqrt(uint32_t x) {
+    uint32_t root = 0;
+    uint32_t bit = 1u << 30;
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (x >= root + bit) {
+            x -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+// Output the amplitude of the sinusoid in each bin, up to half the size, in
+// the units of the input samples and before correcting for the window's gain.
+static void fixed_magnitude(spectrum_fft_obj_t *self, int exponent, uint16_t *out) {
+    // |X[k]| * 2 / size, where X = re/im << exponent.
+    int shift = exponent + 1 - self->log2_size;
+    for (uint32_t k = 0; k < self->size / 2u; k++) {
+        int32_t r = self->re[k];
+        int32_t i = self->im[k];
+        uint32_t m = isqrt((uint32_t)(r * r) + (uint32_t)(i * i));
+        m = shift >= 0 ? m << shift : m >> -shift;
+        out[k] = MIN(m, 0xffff);
+    }
+}
+
+// Load a windowed sample into bit reversed position and track its size.
+#define LOAD(i, sample) do { \
+        uint32_t j = bit_reverse(i, self->log2_size); \
+        int32_t v = ((int32_t)(sample) * self->window[i]) >> 15; \
+        self->re[j] = v; \
+        self->im[j] = 0; \
+        peak |= (uint32_t)(v < 0 ? -v : v); \
+} while (0)
+
+void common_hal_spectrum_fft_magnitude_from_buffer(spectrum_fft_obj_t *self, const mp_buffer_info_t *bufinfo, uint16_t *out) {
+    uint32_t peak = 0;
+    uint32_t size = self->size;
+    switch (bufinfo->typecode) {
+        case 'h':
+            for (uint32_t i = 0; i < size; i++) {
+                LOAD(i, ((int16_t *)bufinfo->buf)[i]);
+            }
+            break;
+        case 'H':
+            for (uint32_t i = 0; i < size; i++) {
+                LOAD(i, ((uint16_t *)bufinfo->buf)[i] - 0x8000);
+            }
+            break;
+        case 'b':
+            for (uint32_t i = 0; i < size; i++) {
+                LOAD(i, ((int8_t *)bufinfo->buf)[i] * 256);
+            }
+            break;
+        default:
+            for (uint32_t i = 0; i < size; i++) {
+                LOAD(i, (((uint8_t *)bufinfo->buf)[i] - 0x80) * 256);
+            }
+            break;
+    }
+    fixed_magnitude(self, fixed_fft(self, peak), out);
+}
+
+void common_hal_spectrum_fft_magnitude_from_sample(spectrum_fft_obj_t *self, mp_obj_t sample, uint16_t *out) {
+    bool single_buffer, samples_signed;
+    uint32_t max_buffer_length;
+    uint8_t spacing;
+    audiosample_get_buffer_structure(sample, false, &single_buffer, &samples_signed, &max_buffer_length, &spacing);
+    uint8_t channel_count = audiosample_channel_count(sample);
+    uint8_t bytes_per_sample = audiosample_bits_per_sample(sample) / 8;
+    uint32_t stride = channel_count * bytes_per_sample;
+
+    // Use the first channel of as many blocks as it takes to fill the
+    // transform, and zeros if the sample ends first.
+    uint32_t peak = 0;
+    uint32_t i = 0;
+    audioio_get_buffer_result_t result = GET_BUFFER_MORE_DATA;
+    while (i < self->size && result == GET_BUFFER_MORE_DATA) {
+        uint8_t *buffer;
+        uint32_t buffer_length;
+        result = audiosample_get_buffer(sample, false, 0, &buffer, &buffer_length);
+        if (result == GET_BUFFER_ERROR) {
+            mp_raise_OSError(MP_EIO);
+        }
+        uint32_t frames = MIN(buffer_length / stride, self->size - i);
+        for (uint32_t f = 0; f < frames; f++, i++, buffer += stride) {
+            int32_t s;
+            if (bytes_per_sample == 2) {
+                // The sample's buffer isn't necessarily 16 bit aligned.
+                uint16_t v;
+                memcpy(&v, buffer, sizeof(v));
+                s = samples_signed ? (int16_t)v : v - 0x8000;
+            } else {
+                uint8_t v = *buffer;
+                s = (samples_signed ? (int8_t)v : v - 0x80) * 256;
+            }
+            LOAD(i, s);
+        }
+    }
+    for (; i < self->size; i++) {
+        LOAD(i, 0);
+    }
+    fixed_magnitude(self, fixed_fft(self, peak), out);
+}
+
+void common_hal_spectrum_fft_transform(spectrum_fft_obj_t *self, float *re, float *im) {
+    uint32_t size = self->size;
+    if (self->float_twiddle == NULL) {
+        self->float_twiddle = m_malloc(size * sizeof(float));
+        for (size_t k = 0; k < size / 2; k++) {
+            mp_float_t phase = 2 * MP_PI * k / size;
+            self->float_twiddle[2 * k] = (float)MICROPY_FLOAT_C_FUN(cos)(phase);
+            self->float_twiddle[2 * k + 1] = (float)-MICROPY_FLOAT_C_FUN(sin)(phase);
+        }
+    }
+
+    for (uint32_t i = 0; i < size; i++) {
+        uint32_t j = bit_reverse(i, self->log2_size);
+        if (j > i) {
+            float t = re[i];
+            re[i] = re[j];
+            re[j] = t;
+            t = im[i];
+            im[i] = im[j];
+            im[j] = t;
+        }
+    }
+
+    const float *twiddle = self->float_twiddle;
+    for (uint32_t half = 1, step = size / 2; half < size; half *= 2, step /= 2) {
+        for (uint32_t k = 0; k < half; k++) {
+            float wr = twiddle[2 * k * step];
+            float wi = twiddle[2 * k * step + 1];
+            for (uint32_t a = k; a < size; a += 2 * half) {
+                uint32_t b = a + half;
+                float tr = re[b] * wr - im[b] * wi;
+                float ti = re[b] * wi + im[b] * wr;
+                re[b] = re[a] - tr;
+                im[b] = im[a] - ti;
+                re[a] += tr;
+                im[a] += ti;
+            }
+        }
+    }
+}
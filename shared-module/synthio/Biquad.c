@@ -25,78 +25,82 @@
  */
 
 #include <math.h>
+#include <string.h>
+#include "py/runtime.h"
 #include "shared-bindings/synthio/Biquad.h"
 #include "shared-module/synthio/Biquad.h"
+#include "shared-module/synthio/BlockBiquad.h"
 
-mp_obj_t common_hal_synthio_new_lpf(mp_float_t w0, mp_float_t Q) {
+// Coefficients from the Audio EQ cookbook, pre-divided by a0, in the order
+// of the Biquad fields: a1, a2, b0, b1, b2.
+void synthio_biquad_coefficients(mp_float_t coefficients[5], synthio_filter_mode_t mode, mp_float_t w0, mp_float_t Q) {
     mp_float_t s = MICROPY_FLOAT_C_FUN(sin)(w0);
     mp_float_t c = MICROPY_FLOAT_C_FUN(cos)(w0);
     mp_float_t alpha = s / (2 * Q);
     mp_float_t a0 = 1 + alpha;
     mp_float_t a1 = -2 * c;
     mp_float_t a2 = 1 - alpha;
-    mp_float_t b0 = (1 - c) / 2;
-    mp_float_t b1 = 1 - c;
-    mp_float_t b2 = (1 - c) / 2;
-
-    mp_obj_t out_args[] = {
-        mp_obj_new_float(a1 / a0),
-        mp_obj_new_float(a2 / a0),
-        mp_obj_new_float(b0 / a0),
-        mp_obj_new_float(b1 / a0),
-        mp_obj_new_float(b2 / a0),
-    };
+    mp_float_t b0, b1, b2;
+    switch (mode) {
+        case SYNTHIO_LOW_PASS:
+        default:
+            b0 = (1 - c) / 2;
+            b1 = 1 - c;
+            b2 = (1 - c) / 2;
+            break;
+        case SYNTHIO_HIGH_PASS:
+            b0 = (1 + c) / 2;
+            b1 = -(1 + c);
+            b2 = (1 + c) / 2;
+            break;
+        case SYNTHIO_BAND_PASS:
+            b0 = alpha;
+            b1 = 0;
+            b2 = -alpha;
+            break;
+        case SYNTHIO_NOTCH:
+            b0 = 1;
+            b1 = -2 * c;
+            b2 = 1;
+            break;
+    }
+    coefficients[0] = a1 / a0;
+    coefficients[1] = a2 / a0;
+    coefficients[2] = b0 / a0;
+    coefficients[3] = b1 / a0;
+    coefficients[4] = b2 / a0;
+}
+
+STATIC mp_obj_t new_biquad(synthio_filter_mode_t mode, mp_float_t w0, mp_float_t Q) {
+    mp_float_t coefficients[5];
+    synthio_biquad_coefficients(coefficients, mode, w0, Q);
+
+    mp_obj_t out_args[5];
+    for (size_t i = 0; i < MP_ARRAY_SIZE(out_args); i++) {
+        out_args[i] = mp_obj_new_float(coefficients[i]);
+    }
 
     return namedtuple_make_new((const mp_obj_type_t *)&synthio_biquad_type_obj, MP_ARRAY_SIZE(out_args), 0, out_args);
 }
 
-mp_obj_t common_hal_synthio_new_hpf(mp_float_t w0, mp_float_t Q) {
-    mp_float_t s = MICROPY_FLOAT_C_FUN(sin)(w0);
-    mp_float_t c = MICROPY_FLOAT_C_FUN(cos)(w0);
-    mp_float_t alpha = s / (2 * Q);
-    mp_float_t a0 = 1 + alpha;
-    mp_float_t a1 = -2 * c;
-    mp_float_t a2 = 1 - alpha;
-    mp_float_t b0 = (1 + c) / 2;
-    mp_float_t b1 = -(1 + c);
-    mp_float_t b2 = (1 + c) / 2;
-
-    mp_obj_t out_args[] = {
-        mp_obj_new_float(a1 / a0),
-        mp_obj_new_float(a2 / a0),
-        mp_obj_new_float(b0 / a0),
-        mp_obj_new_float(b1 / a0),
-        mp_obj_new_float(b2 / a0),
-    };
+mp_obj_t common_hal_synthio_new_lpf(mp_float_t w0, mp_float_t Q) {
+    return new_biquad(SYNTHIO_LOW_PASS, w0, Q);
+}
 
-    return namedtuple_make_new((const mp_obj_type_t *)&synthio_biquad_type_obj, MP_ARRAY_SIZE(out_args), 0, out_args);
+mp_obj_t common_hal_synthio_new_hpf(mp_float_t w0, mp_float_t Q) {
+    return new_biquad(SYNTHIO_HIGH_PASS, w0, Q);
 }
 
 mp_obj_t common_hal_synthio_new_bpf(mp_float_t w0, mp_float_t Q) {
-    mp_float_t s = MICROPY_FLOAT_C_FUN(sin)(w0);
-    mp_float_t c = MICROPY_FLOAT_C_FUN(cos)(w0);
-    mp_float_t alpha = s / (2 * Q);
-    mp_float_t a0 = 1 + alpha;
-    mp_float_t a1 = -2 * c;
-    mp_float_t a2 = 1 - alpha;
-    mp_float_t b0 = alpha;
-    mp_float_t b1 = 0;
-    mp_float_t b2 = -alpha;
-
-    mp_obj_t out_args[] = {
-        mp_obj_new_float(a1 / a0),
-        mp_obj_new_float(a2 / a0),
-        mp_obj_new_float(b0 / a0),
-        mp_obj_new_float(b1 / a0),
-        mp_obj_new_float(b2 / a0),
-    };
-
-    return namedtuple_make_new((const mp_obj_type_t *)&synthio_biquad_type_obj, MP_ARRAY_SIZE(out_args), 0, out_args);
+    return new_biquad(SYNTHIO_BAND_PASS, w0, Q);
 }
 
 #define BIQUAD_SHIFT (15)
+STATIC int32_t biquad_scale(mp_float_t arg) {
+    return (int32_t)MICROPY_FLOAT_C_FUN(round)(MICROPY_FLOAT_C_FUN(ldexp)(arg, BIQUAD_SHIFT));
+}
 STATIC int32_t biquad_scale_arg_obj(mp_obj_t arg) {
-    return (int32_t)MICROPY_FLOAT_C_FUN(round)(MICROPY_FLOAT_C_FUN(ldexp)(mp_obj_get_float(arg), BIQUAD_SHIFT));
+    return biquad_scale(mp_obj_get_float(arg));
 }
 void synthio_biquad_filter_assign(biquad_filter_state *st, mp_obj_t biquad_obj) {
     if (biquad_obj != mp_const_none) {
@@ -141,3 +145,129 @@ void synthio_biquad_filter_samples(biquad_filter_state *st, int32_t *buffer, siz
     st->y[0] = y0;
     st->y[1] = y1;
 }
+
+STATIC int32_t clip16(int32_t value) {
+    return MIN(32767, MAX(-32768, value));
+}
+
+// Two stages in one pass over the buffer. The first stage's output is
+// clipped to 16 bits before it feeds the second, which keeps the products in
+// the second stage from overflowing however resonant the first one is.
+STATIC void biquad_filter_samples_pair(biquad_filter_state *p, biquad_filter_state *q, int32_t *buffer, size_t n_samples) {
+    int32_t pa1 = p->a1, pa2 = p->a2, pb0 = p->b0, pb1 = p->b1, pb2 = p->b2;
+    int32_t qa1 = q->a1, qa2 = q->a2, qb0 = q->b0, qb1 = q->b1, qb2 = q->b2;
+    int32_t px0 = p->x[0], px1 = p->x[1], py0 = p->y[0], py1 = p->y[1];
+    int32_t qx0 = q->x[0], qx1 = q->x[1], qy0 = q->y[0], qy1 = q->y[1];
+
+    for (size_t n = n_samples; n; --n, ++buffer) {
+        int32_t input = *buffer;
+        int32_t mid = (pb0 * input + pb1 * px0 + pb2 * px1 - pa1 * py0 - pa2 * py1 + (1 << (BIQUAD_SHIFT - 1))) >> BIQUAD_SHIFT;
+        px1 = px0;
+        px0 = input;
+        py1 = py0;
+        py0 = mid;
+
+        mid = clip16(mid);
+        int32_t output = (qb0 * mid + qb1 * qx0 + qb2 * qx1 - qa1 * qy0 - qa2 * qy1 + (1 << (BIQUAD_SHIFT - 1))) >> BIQUAD_SHIFT;
+        qx1 = qx0;
+        qx0 = mid;
+        qy1 = qy0;
+        qy0 = output;
+        *buffer = clip16(output);
+    }
+    p->x[0] = px0;
+    p->x[1] = px1;
+    p->y[0] = py0;
+    p->y[1] = py1;
+    q->x[0] = qx0;
+    q->x[1] = qx1;
+    q->y[0] = qy0;
+    q->y[1] = qy1;
+}
+
+STATIC void synthio_filter_chain_assign_stage(synthio_filter_chain_t *chain, mp_obj_t stage_obj) {
+    if (chain->count == SYNTHIO_FILTER_MAX_STAGES) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q length must be <= %d"), MP_QSTR_filter, SYNTHIO_FILTER_MAX_STAGES);
+    }
+    biquad_filter_state *st = &chain->stage[chain->count];
+    if (!mp_obj_is_type(stage_obj, &synthio_block_biquad_type)) {
+        // synthio_biquad_filter_assign() accepts None, which isn't a stage.
+        mp_arg_validate_type(stage_obj, (const mp_obj_type_t *)&synthio_biquad_type_obj, MP_QSTR_filter);
+        synthio_biquad_filter_assign(st, stage_obj);
+    }
+    chain->stage_obj[chain->count] = stage_obj;
+    // Forces the coefficients of a BlockBiquad to be computed on the next block
+    chain->f0[chain->count] = -1;
+    chain->count++;
+}
+
+// The new chain is built in a copy, so that if any stage is invalid the note
+// keeps its old filter rather than a partly assigned one.
+void synthio_filter_chain_assign(synthio_filter_chain_t *chain, mp_obj_t filter_obj) {
+    synthio_filter_chain_t new_chain = *chain;
+    new_chain.count = 0;
+    if (filter_obj == mp_const_none) {
+        // Nothing to validate.
+    } else if (mp_obj_is_type(filter_obj, (const mp_obj_type_t *)&synthio_biquad_type_obj)
+               || mp_obj_is_type(filter_obj, &synthio_block_biquad_type)) {
+        synthio_filter_chain_assign_stage(&new_chain, filter_obj);
+    } else {
+        mp_obj_iter_buf_t iter_buf;
+        mp_obj_t iterable = mp_getiter(filter_obj, &iter_buf);
+        mp_obj_t item;
+        while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+            synthio_filter_chain_assign_stage(&new_chain, item);
+        }
+    }
+    *chain = new_chain;
+}
+
+void synthio_filter_chain_reset(synthio_filter_chain_t *chain) {
+    for (size_t i = 0; i < chain->count; i++) {
+        synthio_biquad_filter_reset(&chain->stage[i]);
+    }
+}
+
+void synthio_filter_chain_update(synthio_filter_chain_t *chain, int32_t sample_rate) {
+    for (size_t i = 0; i < chain->count; i++) {
+        if (!mp_obj_is_type(chain->stage_obj[i], &synthio_block_biquad_type)) {
+            continue;
+        }
+        synthio_block_biquad_obj_t *block_biquad = MP_OBJ_TO_PTR(chain->stage_obj[i]);
+        mp_float_t f0 = synthio_block_slot_get_limited(&block_biquad->f0, 0, sample_rate / 2);
+        mp_float_t Q = synthio_block_slot_get_limited(&block_biquad->Q, MICROPY_FLOAT_CONST(0.01), 100);
+        // Only an exact repeat can reuse the coefficients. Compare the bits,
+        // as float equality is a warning in board builds.
+        if (memcmp(&f0, &chain->f0[i], sizeof(f0)) == 0 && memcmp(&Q, &chain->Q[i], sizeof(Q)) == 0) {
+            continue;
+        }
+        chain->f0[i] = f0;
+        chain->Q[i] = Q;
+
+        mp_float_t coefficients[5];
+        synthio_biquad_coefficients(coefficients, block_biquad->mode, f0 / sample_rate * 2 * MICROPY_FLOAT_CONST(3.14159265358979323846), Q);
+        biquad_filter_state *st = &chain->stage[i];
+        st->a1 = biquad_scale(coefficients[0]);
+        st->a2 = biquad_scale(coefficients[1]);
+        st->b0 = biquad_scale(coefficients[2]);
+        st->b1 = biquad_scale(coefficients[3]);
+        st->b2 = biquad_scale(coefficients[4]);
+    }
+}
+
+void synthio_filter_chain_samples(synthio_filter_chain_t *chain, int32_t *buffer, size_t n_samples) {
+    if (chain->count == 1) {
+        synthio_biquad_filter_samples(&chain->stage[0], buffer, n_samples);
+        return;
+    }
+    size_t i = 0;
+    for (; i + 1 < chain->count; i += 2) {
+        biquad_filter_samples_pair(&chain->stage[i], &chain->stage[i + 1], buffer, n_samples);
+    }
+    if (i < chain->count) {
+        synthio_biquad_filter_samples(&chain->stage[i], buffer, n_samples);
+        for (size_t n = 0; n < n_samples; n++) {
+            buffer[n] = clip16(buffer[n]);
+        }
+    }
+}
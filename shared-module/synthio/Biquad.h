@@ -27,12 +27,31 @@
 #pragma once
 
 #include "py/obj.h"
+#include "shared-bindings/synthio/BlockBiquad.h"
+
+#define SYNTHIO_FILTER_MAX_STAGES (4)
 
 typedef struct {
     int32_t a1, a2, b0, b1, b2;
     int32_t x[2], y[2];
 } biquad_filter_state;
 
+// The filters of a note, applied one after the other. Each stage is either a
+// fixed Biquad or a BlockBiquad, whose coefficients are recomputed once per
+// block when its inputs change.
+typedef struct {
+    mp_obj_t stage_obj[SYNTHIO_FILTER_MAX_STAGES];
+    mp_float_t f0[SYNTHIO_FILTER_MAX_STAGES], Q[SYNTHIO_FILTER_MAX_STAGES];
+    biquad_filter_state stage[SYNTHIO_FILTER_MAX_STAGES];
+    uint8_t count;
+} synthio_filter_chain_t;
+
+void synthio_biquad_coefficients(mp_float_t coefficients[5], synthio_filter_mode_t mode, mp_float_t w0, mp_float_t Q);
 void synthio_biquad_filter_assign(biquad_filter_state *st, mp_obj_t biquad_obj);
 void synthio_biquad_filter_reset(biquad_filter_state *st);
 void synthio_biquad_filter_samples(biquad_filter_state *st, int32_t *buffer, size_t n_samples);
+
+void synthio_filter_chain_assign(synthio_filter_chain_t *chain, mp_obj_t filter_obj);
+void synthio_filter_chain_reset(synthio_filter_chain_t *chain);
+void synthio_filter_chain_update(synthio_filter_chain_t *chain, int32_t sample_rate);
+void synthio_filter_chain_samples(synthio_filter_chain_t *chain, int32_t *buffer, size_t n_samples);
@@ -0,0 +1,55 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-bindings/synthio/BlockBiquad.h"
+#include "shared-module/synthio/BlockBiquad.h"
+
+void common_hal_synthio_block_biquad_construct(synthio_block_biquad_obj_t *self, synthio_filter_mode_t mode, mp_obj_t f0, mp_obj_t Q) {
+    self->mode = mode;
+    synthio_block_assign_slot(f0, &self->f0, MP_QSTR_frequency);
+    synthio_block_assign_slot(Q, &self->Q, MP_QSTR_Q);
+}
+
+synthio_filter_mode_t common_hal_synthio_block_biquad_get_mode(synthio_block_biquad_obj_t *self) {
+    return self->mode;
+}
+
+mp_obj_t common_hal_synthio_block_biquad_get_frequency(synthio_block_biquad_obj_t *self) {
+    return self->f0.obj;
+}
+
+void common_hal_synthio_block_biquad_set_frequency(synthio_block_biquad_obj_t *self, mp_obj_t frequency) {
+    synthio_block_assign_slot(frequency, &self->f0, MP_QSTR_frequency);
+}
+
+mp_obj_t common_hal_synthio_block_biquad_get_Q(synthio_block_biquad_obj_t *self) {
+    return self->Q.obj;
+}
+
+void common_hal_synthio_block_biquad_set_Q(synthio_block_biquad_obj_t *self, mp_obj_t Q) {
+    synthio_block_assign_slot(Q, &self->Q, MP_QSTR_Q);
+}
@@ -65,20 +65,40 @@ static int decode_duration(synthio_miditrack_obj_t *self) {
     return delta * self->synth.sample_rate / self->tempo;
 }
 
+// A note change that is already due takes effect at once; later ones are
+// queued so that the synthesizer can apply them on the right sample.
+STATIC bool change_note(synthio_miditrack_obj_t *self, synthio_event_kind_t kind, mp_obj_t note) {
+    if ((int32_t)(self->next_time - self->synth.sample_time) <= 0) {
+        synthio_event_t event = { .time = self->next_time, .kind = kind, .target = note, .value = mp_const_none };
+        synthio_synth_apply_event(&self->synth, &event);
+        return true;
+    }
+    return synthio_synth_schedule(&self->synth, self->next_time, kind, note, mp_const_none);
+}
+
 // invariant: pointing at a MIDI message
-static void decode_until_pause(synthio_miditrack_obj_t *self) {
+// Decode messages until reaching one at or after horizon, or until the event
+// queue is full.
+static void decode_until(synthio_miditrack_obj_t *self, uint32_t horizon) {
     uint8_t *buffer = self->track.buf;
     size_t len = self->track.len;
-    do {
+    while (self->pos < len && (int32_t)(self->next_time - horizon) < 0) {
+        size_t start = self->pos;
         switch (buffer[self->pos++] >> 4) {
             case 8: { // Note Off
                 mp_obj_t note = parse_note(self);
-                synthio_span_change_note(&self->synth, note, SYNTHIO_SILENCE);
+                if (!change_note(self, SYNTHIO_EVENT_RELEASE, note)) {
+                    self->pos = start;
+                    return;
+                }
                 break;
             }
             case 9: { // Note On
                 mp_obj_t note = parse_note(self);
-                synthio_span_change_note(&self->synth, SYNTHIO_SILENCE, note);
+                if (!change_note(self, SYNTHIO_EVENT_PRESS, note)) {
+                    self->pos = start;
+                    return;
+                }
                 break;
             }
             case 10:
@@ -99,19 +119,17 @@ static void decode_until_pause(synthio_miditrack_obj_t *self) {
                 record_midi_stream_error(self);
         }
         if (self->pos < len) {
-            self->synth.span.dur = decode_duration(self);
+            self->next_time += decode_duration(self);
         }
-    } while (self->pos < len && self->synth.span.dur == 0);
+    }
 }
 
 STATIC void start_parse(synthio_miditrack_obj_t *self) {
     self->pos = 0;
     self->error_location = -1;
-    self->synth.span.dur = decode_duration(self);
-    if (self->synth.span.dur == 0) {
-        // the usual case: the file starts with some MIDI event, not a delay
-        decode_until_pause(self);
-    }
+    synthio_synth_clear_events(&self->synth);
+    self->synth.sample_time = 0;
+    self->next_time = decode_duration(self);
 }
 
 void common_hal_synthio_miditrack_construct(synthio_miditrack_obj_t *self,
@@ -122,7 +140,8 @@ void common_hal_synthio_miditrack_construct(synthio_miditrack_obj_t *self,
     self->track.buf = (void *)buffer;
     self->track.len = len;
 
-    synthio_synth_init(&self->synth, sample_rate, 1, waveform_obj, envelope_obj);
+    synthio_synth_init(&self->synth, sample_rate, 1, CIRCUITPY_SYNTHIO_MAX_CHANNELS, false, waveform_obj, envelope_obj);
+    synthio_synth_events_init(&self->synth);
 
     start_parse(self);
 }
@@ -162,13 +181,18 @@ audioio_get_buffer_result_t synthio_miditrack_get_buffer(synthio_miditrack_obj_t
         return GET_BUFFER_ERROR;
     }
 
+    // Queue up the messages for this block, so that the synthesizer applies
+    // each of them on its own sample instead of ending the block early.
+    uint32_t now = self->synth.sample_time;
+    synthio_synth_run_events(&self->synth);
+    decode_until(self, now + SYNTHIO_MAX_DUR);
+    // This is a whole block unless the track ends first, or the queue filled
+    // up before the next message.
+    self->synth.span.dur = MIN(SYNTHIO_MAX_DUR, self->next_time - now);
+
     synthio_synth_synthesize(&self->synth, buffer, buffer_length, single_channel_output ? 0 : channel);
-    if (self->synth.span.dur == 0) {
-        if (self->pos == self->track.len) {
-            return GET_BUFFER_DONE;
-        } else {
-            decode_until_pause(self);
-        }
+    if (self->synth.span.dur == 0 && self->pos == self->track.len) {
+        return GET_BUFFER_DONE;
     }
     return GET_BUFFER_MORE_DATA;
 }
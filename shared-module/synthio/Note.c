@@ -45,7 +45,7 @@ mp_obj_t common_hal_synthio_note_get_filter_obj(synthio_note_obj_t *self) {
 }
 
 void common_hal_synthio_note_set_filter(synthio_note_obj_t *self, mp_obj_t filter_in) {
-    synthio_biquad_filter_assign(&self->filter_state, filter_in);
+    synthio_filter_chain_assign(&self->filter, filter_in);
     self->filter_obj = filter_in;
 }
 
@@ -118,6 +118,28 @@ void common_hal_synthio_note_set_waveform(synthio_note_obj_t *self, mp_obj_t wav
         self->waveform_buf = bufinfo_waveform;
     }
     self->waveform_obj = waveform_in;
+    // Always rebuild, the buffer's contents may have changed. The band limited
+    // copies are made when the note is next played.
+    synthio_mipmap_clear(&self->waveform_mipmap);
+}
+
+bool common_hal_synthio_note_get_interpolate(synthio_note_obj_t *self) {
+    return self->interpolate;
+}
+
+void common_hal_synthio_note_set_interpolate(synthio_note_obj_t *self, bool value) {
+    self->interpolate = value;
+}
+
+bool common_hal_synthio_note_get_band_limit(synthio_note_obj_t *self) {
+    return self->band_limit;
+}
+
+void common_hal_synthio_note_set_band_limit(synthio_note_obj_t *self, bool value) {
+    self->band_limit = value;
+    if (!value) {
+        synthio_mipmap_clear(&self->waveform_mipmap);
+    }
 }
 
 mp_int_t common_hal_synthio_note_get_waveform_loop_start(synthio_note_obj_t *self) {
@@ -184,7 +206,7 @@ void synthio_note_recalculate(synthio_note_obj_t *self, int32_t sample_rate) {
 
 void synthio_note_start(synthio_note_obj_t *self, int32_t sample_rate) {
     synthio_note_recalculate(self, sample_rate);
-    synthio_biquad_filter_reset(&self->filter_state);
+    synthio_filter_chain_reset(&self->filter);
 }
 
 // Perform a pitch bend operation
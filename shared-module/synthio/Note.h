@@ -40,7 +40,7 @@ typedef struct synthio_note_obj {
     mp_obj_t waveform_obj, envelope_obj, ring_waveform_obj;
     mp_obj_t filter_obj;
 
-    biquad_filter_state filter_state;
+    synthio_filter_chain_t filter;
 
     int32_t sample_rate;
 
@@ -48,7 +48,9 @@ typedef struct synthio_note_obj {
     int32_t ring_frequency_scaled, ring_frequency_bent;
 
     mp_buffer_info_t waveform_buf;
+    synthio_mipmap_t waveform_mipmap;
     uint32_t waveform_loop_start, waveform_loop_end;
+    bool interpolate, band_limit;
     mp_buffer_info_t ring_waveform_buf;
     uint32_t ring_waveform_loop_start, ring_waveform_loop_end;
     synthio_envelope_definition_t envelope_def;
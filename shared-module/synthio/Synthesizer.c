@@ -33,10 +33,10 @@
 
 
 void common_hal_synthio_synthesizer_construct(synthio_synthesizer_obj_t *self,
-    uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj,
-    mp_obj_t envelope_obj) {
+    uint32_t sample_rate, int channel_count, int voice_count, bool voice_stealing,
+    mp_obj_t waveform_obj, mp_obj_t envelope_obj) {
 
-    synthio_synth_init(&self->synth, sample_rate, channel_count, waveform_obj, envelope_obj);
+    synthio_synth_init(&self->synth, sample_rate, channel_count, voice_count, voice_stealing, waveform_obj, envelope_obj);
     self->blocks = mp_obj_new_list(0, NULL);
 }
 
@@ -56,6 +56,15 @@ uint8_t common_hal_synthio_synthesizer_get_bits_per_sample(synthio_synthesizer_o
 uint8_t common_hal_synthio_synthesizer_get_channel_count(synthio_synthesizer_obj_t *self) {
     return self->synth.channel_count;
 }
+mp_int_t common_hal_synthio_synthesizer_get_voice_count(synthio_synthesizer_obj_t *self) {
+    return self->synth.voice_count;
+}
+bool common_hal_synthio_synthesizer_get_voice_stealing(synthio_synthesizer_obj_t *self) {
+    return self->synth.voice_stealing;
+}
+void common_hal_synthio_synthesizer_set_voice_stealing(synthio_synthesizer_obj_t *self, bool value) {
+    self->synth.voice_stealing = value;
+}
 
 void synthio_synthesizer_reset_buffer(synthio_synthesizer_obj_t *self,
     bool single_channel_output, uint8_t channel) {
@@ -93,7 +102,7 @@ void synthio_synthesizer_get_buffer_structure(synthio_synthesizer_obj_t *self, b
 }
 
 void common_hal_synthio_synthesizer_release_all(synthio_synthesizer_obj_t *self) {
-    for (size_t i = 0; i < CIRCUITPY_SYNTHIO_MAX_CHANNELS; i++) {
+    for (size_t i = 0; i < self->synth.voice_count; i++) {
         if (self->synth.span.note_obj[i] != SYNTHIO_SILENCE) {
             synthio_span_change_note(&self->synth, self->synth.span.note_obj[i], SYNTHIO_SILENCE);
         }
@@ -169,15 +178,116 @@ void common_hal_synthio_synthesizer_retrigger(synthio_synthesizer_obj_t *self, m
     }
 }
 
+uint32_t common_hal_synthio_synthesizer_get_sample_time(synthio_synthesizer_obj_t *self) {
+    return self->synth.sample_time;
+}
+
+// Get the items of a single note or LFO, or of a sequence of them. The items
+// are looked at twice, once to validate them and once to schedule them, so
+// other iterables are copied into a tuple.
+STATIC void get_items(mp_obj_t *obj, bool single, size_t *len, mp_obj_t **items) {
+    if (single) {
+        *len = 1;
+        *items = obj;
+        return;
+    }
+    if (!mp_obj_is_type(*obj, &mp_type_tuple) && !mp_obj_is_type(*obj, &mp_type_list)) {
+        *obj = mp_call_function_1(MP_OBJ_FROM_PTR(&mp_type_tuple), *obj);
+    }
+    mp_obj_get_array(*obj, len, items);
+}
+
+STATIC void check_event_space(synthio_synthesizer_obj_t *self, size_t n) {
+    if (n > (size_t)(SYNTHIO_MAX_EVENTS - self->synth.event_count)) {
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("schedule queue full"));
+    }
+}
+
+void common_hal_synthio_synthesizer_schedule(synthio_synthesizer_obj_t *self, uint32_t time, mp_obj_t to_release, mp_obj_t to_press, mp_obj_t to_retrigger) {
+    size_t n_release, n_press, n_retrigger;
+    mp_obj_t *release, *press, *retrigger;
+    get_items(&to_release, is_note(to_release), &n_release, &release);
+    get_items(&to_press, is_note(to_press), &n_press, &press);
+    get_items(&to_retrigger, mp_obj_is_type(to_retrigger, &synthio_lfo_type), &n_retrigger, &retrigger);
+
+    // Validate everything first, so that either all of the changes are
+    // scheduled or none of them are.
+    for (size_t i = 0; i < n_release; i++) {
+        validate_note(release[i]);
+    }
+    for (size_t i = 0; i < n_press; i++) {
+        validate_note(press[i]);
+    }
+    for (size_t i = 0; i < n_retrigger; i++) {
+        mp_arg_validate_type(retrigger[i], &synthio_lfo_type, MP_QSTR_retrigger);
+    }
+    synthio_synth_events_init(&self->synth);
+    check_event_space(self, n_release + n_press + n_retrigger);
+
+    for (size_t i = 0; i < n_release; i++) {
+        synthio_synth_schedule(&self->synth, time, SYNTHIO_EVENT_RELEASE, release[i], mp_const_none);
+    }
+    for (size_t i = 0; i < n_press; i++) {
+        synthio_synth_schedule(&self->synth, time, SYNTHIO_EVENT_PRESS, press[i], mp_const_none);
+    }
+    for (size_t i = 0; i < n_retrigger; i++) {
+        synthio_synth_schedule(&self->synth, time, SYNTHIO_EVENT_RETRIGGER, retrigger[i], mp_const_none);
+    }
+}
+
+void common_hal_synthio_synthesizer_schedule_change(synthio_synthesizer_obj_t *self, uint32_t time, mp_obj_t note_in,
+    mp_obj_t frequency, mp_obj_t amplitude, mp_obj_t bend, mp_obj_t panning) {
+    mp_arg_validate_type(note_in, &synthio_note_type, MP_QSTR_note);
+
+    // Convert the values now, the same way the Note properties do, so that
+    // applying them later cannot fail.
+    synthio_block_slot_t slot;
+    if (frequency != mp_const_none) {
+        frequency = mp_obj_new_float(mp_arg_validate_float_range(mp_obj_get_float(frequency), 0, 32767, MP_QSTR_frequency));
+    }
+    if (amplitude != mp_const_none) {
+        synthio_block_assign_slot(amplitude, &slot, MP_QSTR_amplitude);
+        amplitude = slot.obj;
+    }
+    if (bend != mp_const_none) {
+        synthio_block_assign_slot(bend, &slot, MP_QSTR_bend);
+        bend = slot.obj;
+    }
+    if (panning != mp_const_none) {
+        synthio_block_assign_slot(panning, &slot, MP_QSTR_panning);
+        panning = slot.obj;
+    }
+
+    synthio_synth_events_init(&self->synth);
+    check_event_space(self, (frequency != mp_const_none) + (amplitude != mp_const_none) + (bend != mp_const_none) + (panning != mp_const_none));
+
+    if (frequency != mp_const_none) {
+        synthio_synth_schedule(&self->synth, time, SYNTHIO_EVENT_FREQUENCY, note_in, frequency);
+    }
+    if (amplitude != mp_const_none) {
+        synthio_synth_schedule(&self->synth, time, SYNTHIO_EVENT_AMPLITUDE, note_in, amplitude);
+    }
+    if (bend != mp_const_none) {
+        synthio_synth_schedule(&self->synth, time, SYNTHIO_EVENT_BEND, note_in, bend);
+    }
+    if (panning != mp_const_none) {
+        synthio_synth_schedule(&self->synth, time, SYNTHIO_EVENT_PANNING, note_in, panning);
+    }
+}
+
+void common_hal_synthio_synthesizer_cancel_scheduled(synthio_synthesizer_obj_t *self) {
+    synthio_synth_clear_events(&self->synth);
+}
+
 mp_obj_t common_hal_synthio_synthesizer_get_pressed_notes(synthio_synthesizer_obj_t *self) {
     int count = 0;
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+    for (int chan = 0; chan < self->synth.voice_count; chan++) {
         if (self->synth.span.note_obj[chan] != SYNTHIO_SILENCE && SYNTHIO_NOTE_IS_PLAYING(&self->synth, chan)) {
             count += 1;
         }
     }
     mp_obj_tuple_t *result = MP_OBJ_TO_PTR(mp_obj_new_tuple(count, NULL));
-    for (size_t chan = 0, j = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+    for (size_t chan = 0, j = 0; chan < self->synth.voice_count; chan++) {
         if (self->synth.span.note_obj[chan] != SYNTHIO_SILENCE && SYNTHIO_NOTE_IS_PLAYING(&self->synth, chan)) {
             result->items[j++] = self->synth.span.note_obj[chan];
         }
@@ -186,7 +296,7 @@ mp_obj_t common_hal_synthio_synthesizer_get_pressed_notes(synthio_synthesizer_ob
 }
 
 envelope_state_e common_hal_synthio_synthesizer_note_info(synthio_synthesizer_obj_t *self, mp_obj_t note, mp_float_t *vol_out) {
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+    for (int chan = 0; chan < self->synth.voice_count; chan++) {
         if (self->synth.span.note_obj[chan] == note) {
             *vol_out = self->synth.envelope_state[chan].level / 32767.;
             return self->synth.envelope_state[chan].state;
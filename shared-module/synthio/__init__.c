@@ -29,6 +29,8 @@
 #include "shared-bindings/synthio/__init__.h"
 #include "shared-module/synthio/Biquad.h"
 #include "shared-module/synthio/Note.h"
+#include "shared-bindings/synthio/LFO.h"
+#include "shared-bindings/synthio/Note.h"
 #include "py/runtime.h"
 #include <math.h>
 #include <stdlib.h>
@@ -149,27 +151,42 @@ STATIC synthio_envelope_definition_t *synthio_synth_get_note_envelope(synthio_sy
 #define RANGE_LOW (-28000)
 #define RANGE_HIGH (28000)
 #define RANGE_SHIFT (16)
-#define RANGE_SCALE (0xfffffff / (32768 * CIRCUITPY_SYNTHIO_MAX_CHANNELS - RANGE_HIGH))
+#define RANGE_SCALE(voice_count) (0xfffffff / (32768 * (voice_count) - RANGE_HIGH))
 
 // dynamic range compression via a downward compressor with hard knee
 //
 // When the output value is within the range +-28000 (about 85% of full scale),
 // it is unchanged. Otherwise, it undergoes a gain reduction so that the
-// largest possible values, (+32768,-32767) * CIRCUITPY_SYNTHIO_MAX_CHANNELS,
-// still fit within the output range
+// largest possible values, (+32768,-32767) * voice_count, still fit within
+// the output range
 //
 // This produces a much louder overall volume with multiple voices, without
 // much additional processing.
 //
+// Both loops are free of branches and data dependent control flow, so the
+// compiler can vectorize them where the target has SIMD instructions. Most
+// blocks never leave the linear range and take the plain narrowing copy.
+//
 // https://en.wikipedia.org/wiki/Dynamic_range_compression
-STATIC
-int16_t mix_down_sample(int32_t sample) {
-    if (sample < RANGE_LOW) {
-        sample = (((sample - RANGE_LOW) * RANGE_SCALE) >> RANGE_SHIFT) + RANGE_LOW;
-    } else if (sample > RANGE_HIGH) {
-        sample = (((sample - RANGE_HIGH) * RANGE_SCALE) >> RANGE_SHIFT) + RANGE_HIGH;
+STATIC void mix_down(int16_t *restrict out_buffer16, const int32_t *restrict in_buffer32, size_t n, int32_t scale) {
+    int32_t lo = 0, hi = 0;
+    for (size_t i = 0; i < n; i++) {
+        int32_t sample = in_buffer32[i];
+        lo = MIN(lo, sample);
+        hi = MAX(hi, sample);
+    }
+    if (lo >= RANGE_LOW && hi <= RANGE_HIGH) {
+        for (size_t i = 0; i < n; i++) {
+            out_buffer16[i] = in_buffer32[i];
+        }
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        int32_t sample = in_buffer32[i];
+        int32_t over = MAX(sample - RANGE_HIGH, 0);
+        int32_t under = MIN(sample - RANGE_LOW, 0);
+        out_buffer16[i] = sample - over - under + ((over * scale) >> RANGE_SHIFT) + ((under * scale) >> RANGE_SHIFT);
     }
-    return sample;
 }
 
 static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *out_buffer32, int16_t dur, int16_t loudness[2]) {
@@ -183,6 +200,10 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
     uint32_t waveform_start = 0;
     uint32_t waveform_length = synth->waveform_bufinfo.len;
 
+    synthio_mipmap_t *mipmap = NULL;
+    const mp_buffer_info_t *mipmap_source = NULL;
+    bool interpolate = false;
+
     uint32_t ring_dds_rate = 0;
     const int16_t *ring_waveform = NULL;
     uint32_t ring_waveform_start = 0;
@@ -201,9 +222,15 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
     } else {
         synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
         int32_t frequency_scaled = synthio_note_step(note, sample_rate, dur, loudness);
+        if (note->band_limit) {
+            mipmap = &synth->waveform_mipmap;
+            mipmap_source = &synth->waveform_bufinfo;
+        }
         if (note->waveform_buf.buf) {
             waveform = note->waveform_buf.buf;
             waveform_length = note->waveform_buf.len;
+            mipmap = note->band_limit ? &note->waveform_mipmap : NULL;
+            mipmap_source = &note->waveform_buf;
             if (note->waveform_loop_start > 0 && note->waveform_loop_start < waveform_length) {
                 waveform_start = note->waveform_loop_start;
             }
@@ -211,6 +238,7 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
                 waveform_length = note->waveform_loop_end;
             }
         }
+        interpolate = note->interpolate;
         dds_rate = synthio_frequency_convert_scaled_to_dds((uint64_t)frequency_scaled * (waveform_length - waveform_start), sample_rate);
         if (note->ring_frequency_scaled != 0 && note->ring_waveform_buf.buf) {
             ring_waveform = note->ring_waveform_buf.buf;
@@ -243,15 +271,50 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
         accum = accum % lim + offset;
     }
 
+    // Pick the band limited level that steps through its table at most one
+    // sample at a time. Levels only exist for whole waveforms, not loops.
+    uint8_t level = 0;
+    const int16_t *table = waveform;
+    uint32_t table_start = waveform_start;
+    uint32_t table_length = waveform_length;
+    if (mipmap != NULL) {
+        synthio_mipmap_build(mipmap, mipmap_source);
+    }
+    if (mipmap != NULL && mipmap->source == waveform && mipmap->length == waveform_length && waveform_start == 0) {
+        while (level < mipmap->level_count && (dds_rate >> (SYNTHIO_FREQUENCY_SHIFT + level)) >= 1) {
+            table = level == 0 ? mipmap->levels : table + table_length;
+            table_length /= 2;
+            level++;
+        }
+    }
+    uint8_t table_shift = SYNTHIO_FREQUENCY_SHIFT + level;
+
     // first, fill with waveform
-    for (uint16_t i = 0; i < dur; i++) {
-        accum += dds_rate;
-        // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
-        if (accum > lim) {
-            accum = accum - lim + offset;
+    if (interpolate) {
+        for (uint16_t i = 0; i < dur; i++) {
+            accum += dds_rate;
+            if (accum >= lim) {
+                accum = accum - lim + offset;
+            }
+            uint32_t idx = accum >> table_shift;
+            uint32_t next = idx + 1;
+            if (next >= table_length) {
+                next = table_start;
+            }
+            int32_t frac = ((accum >> level) & 0xffff) >> 1;
+            int32_t a = table[idx];
+            out_buffer32[i] = a + (((table[next] - a) * frac) >> 15);
+        }
+    } else {
+        for (uint16_t i = 0; i < dur; i++) {
+            accum += dds_rate;
+            // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
+            if (accum >= lim) {
+                accum = accum - lim + offset;
+            }
+            int16_t idx = accum >> table_shift;
+            out_buffer32[i] = table[idx];
         }
-        int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-        out_buffer32[i] = waveform[idx];
     }
     synth->accum[chan] = accum;
 
@@ -287,52 +350,31 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
     return true;
 }
 
-STATIC mp_obj_t synthio_synth_get_note_filter(mp_obj_t note_obj) {
-    if (note_obj == mp_const_none) {
-        return mp_const_none;
+STATIC synthio_filter_chain_t *synthio_synth_get_note_filter(mp_obj_t note_obj) {
+    if (note_obj == mp_const_none || mp_obj_is_small_int(note_obj)) {
+        return NULL;
     }
-    if (!mp_obj_is_small_int(note_obj)) {
-        synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
-        return note->filter_obj;
-    }
-    return mp_const_none;
+    synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
+    return note->filter.count ? &note->filter : NULL;
 }
 
-STATIC void sum_with_loudness(int32_t *out_buffer32, int32_t *tmp_buffer32, int16_t loudness[2], size_t dur, int synth_chan) {
+STATIC void sum_with_loudness(int32_t *restrict out_buffer32, const int32_t *restrict tmp_buffer32, int16_t loudness[2], size_t dur, int synth_chan) {
+    int32_t left = loudness[0], right = loudness[1];
     if (synth_chan == 1) {
         for (size_t i = 0; i < dur; i++) {
-            *out_buffer32++ += (*tmp_buffer32++ *loudness[0]) >> 16;
+            out_buffer32[i] += (tmp_buffer32[i] * left) >> 16;
         }
     } else {
         for (size_t i = 0; i < dur; i++) {
-            *out_buffer32++ += (*tmp_buffer32 * loudness[0]) >> 16;
-            *out_buffer32++ += (*tmp_buffer32++ *loudness[1]) >> 16;
+            out_buffer32[2 * i] += (tmp_buffer32[i] * left) >> 16;
+            out_buffer32[2 * i + 1] += (tmp_buffer32[i] * right) >> 16;
         }
     }
 }
 
-void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t *buffer_length, uint8_t channel) {
-
-    if (channel == synth->other_channel) {
-        *buffer_length = synth->last_buffer_length;
-        *bufptr = (uint8_t *)(synth->buffers[synth->other_buffer_index] + channel);
-        return;
-    }
-
-    shared_bindings_synthio_lfo_tick(synth->sample_rate);
-
-    synth->buffer_index = !synth->buffer_index;
-    synth->other_channel = 1 - channel;
-    synth->other_buffer_index = synth->buffer_index;
-
-    uint16_t dur = MIN(SYNTHIO_MAX_DUR, synth->span.dur);
-    synth->span.dur -= dur;
-
-    int32_t out_buffer32[SYNTHIO_MAX_DUR * synth->channel_count];
-    int32_t tmp_buffer32[SYNTHIO_MAX_DUR];
-    memset(out_buffer32, 0, synth->channel_count * dur * sizeof(int32_t));
-
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+// Render dur samples of every voice into out_buffer32 and advance the envelopes.
+STATIC void synthio_synth_render(synthio_synth_t *synth, int32_t *out_buffer32, int32_t *tmp_buffer32, uint16_t dur) {
+    for (int chan = 0; chan < synth->voice_count; chan++) {
         mp_obj_t note_obj = synth->span.note_obj[chan];
         if (note_obj == SYNTHIO_SILENCE) {
             continue;
@@ -352,32 +394,68 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
             continue;
         }
 
-        mp_obj_t filter_obj = synthio_synth_get_note_filter(note_obj);
-        if (filter_obj != mp_const_none) {
-            synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
-            synthio_biquad_filter_samples(&note->filter_state, tmp_buffer32, dur);
+        synthio_filter_chain_t *filter = synthio_synth_get_note_filter(note_obj);
+        if (filter) {
+            // filter inputs only change at block rate
+            synthio_filter_chain_update(filter, synth->sample_rate);
+            synthio_filter_chain_samples(filter, tmp_buffer32, dur);
         }
 
         // adjust loudness by envelope
         sum_with_loudness(out_buffer32, tmp_buffer32, loudness, dur, synth->channel_count);
     }
 
-    int16_t *out_buffer16 = (int16_t *)(void *)synth->buffers[synth->buffer_index];
-
-    // mix down audio
-    for (size_t i = 0; i < dur * synth->channel_count; i++) {
-        int32_t sample = out_buffer32[i];
-        out_buffer16[i] = mix_down_sample(sample);
-    }
-
     // advance envelope states
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+    for (int chan = 0; chan < synth->voice_count; chan++) {
         mp_obj_t note_obj = synth->span.note_obj[chan];
         if (note_obj == SYNTHIO_SILENCE) {
             continue;
         }
         synthio_envelope_state_step(&synth->envelope_state[chan], synthio_synth_get_note_envelope(synth, note_obj), dur);
     }
+    synth->sample_time += dur;
+}
+
+void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t *buffer_length, uint8_t channel) {
+
+    if (channel == synth->other_channel) {
+        *buffer_length = synth->last_buffer_length;
+        *bufptr = (uint8_t *)(synth->buffers[synth->other_buffer_index] + channel);
+        return;
+    }
+
+    shared_bindings_synthio_lfo_tick(synth->sample_rate);
+
+    synth->buffer_index = !synth->buffer_index;
+    synth->other_channel = 1 - channel;
+    synth->other_buffer_index = synth->buffer_index;
+
+    uint16_t dur = MIN(SYNTHIO_MAX_DUR, synth->span.dur);
+    synth->span.dur -= dur;
+
+    int32_t out_buffer32[SYNTHIO_MAX_DUR * synth->channel_count];
+    int32_t tmp_buffer32[SYNTHIO_MAX_DUR];
+    memset(out_buffer32, 0, synth->channel_count * dur * sizeof(int32_t));
+
+    // Split the block wherever a scheduled event falls inside it, so that
+    // events take effect on the exact sample they were scheduled for.
+    synthio_synth_run_events(synth);
+    for (uint16_t done = 0; done < dur;) {
+        uint16_t part = dur - done;
+        if (synth->event_count) {
+            // run_events left only events that are still in the future
+            uint32_t until = synth->events[0].time - synth->sample_time;
+            part = MIN(part, until);
+        }
+        synthio_synth_render(synth, out_buffer32 + done * synth->channel_count, tmp_buffer32, part);
+        done += part;
+        synthio_synth_run_events(synth);
+    }
+
+    int16_t *out_buffer16 = (int16_t *)(void *)synth->buffers[synth->buffer_index];
+
+    // mix down audio
+    mix_down(out_buffer16, out_buffer32, dur * synth->channel_count, synth->mix_down_scale);
 
     *buffer_length = synth->last_buffer_length = dur * SYNTHIO_BYTES_PER_SAMPLE * synth->channel_count;
     *bufptr = (uint8_t *)out_buffer16;
@@ -397,6 +475,15 @@ bool synthio_synth_deinited(synthio_synth_t *synth) {
 void synthio_synth_deinit(synthio_synth_t *synth) {
     synth->buffers[0] = NULL;
     synth->buffers[1] = NULL;
+    synthio_mipmap_clear(&synth->waveform_mipmap);
+    synth->voice_count = 0;
+    synth->span.note_obj = NULL;
+    synth->accum = NULL;
+    synth->ring_accum = NULL;
+    synth->press_order = NULL;
+    synth->envelope_state = NULL;
+    synth->events = NULL;
+    synth->event_count = 0;
 }
 
 void synthio_synth_envelope_set(synthio_synth_t *synth, mp_obj_t envelope_obj) {
@@ -408,9 +495,20 @@ mp_obj_t synthio_synth_envelope_get(synthio_synth_t *synth) {
     return synth->envelope_obj;
 }
 
-void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope_obj) {
+void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, int voice_count, bool voice_stealing, mp_obj_t waveform_obj, mp_obj_t envelope_obj) {
     synthio_synth_parse_waveform(&synth->waveform_bufinfo, waveform_obj);
     mp_arg_validate_int_range(channel_count, 1, 2, MP_QSTR_channel_count);
+    mp_arg_validate_int_range(voice_count, 1, SYNTHIO_MAX_POLYPHONY, MP_QSTR_voice_count);
+    synth->voice_count = voice_count;
+    synth->voice_stealing = voice_stealing;
+    synth->mix_down_scale = RANGE_SCALE(voice_count);
+    synth->press_count = 0;
+    synth->span.note_obj = m_malloc(voice_count * sizeof(mp_obj_t));
+    synth->accum = m_malloc(voice_count * sizeof(uint32_t));
+    synth->ring_accum = m_malloc(voice_count * sizeof(uint32_t));
+    synth->press_order = m_malloc(voice_count * sizeof(uint32_t));
+    synth->envelope_state = m_malloc(voice_count * sizeof(synthio_envelope_state_t));
+    synthio_mipmap_clear(&synth->waveform_mipmap);
     synth->buffer_length = SYNTHIO_MAX_DUR * SYNTHIO_BYTES_PER_SAMPLE * channel_count;
     synth->buffers[0] = m_malloc(synth->buffer_length);
     synth->buffers[1] = m_malloc(synth->buffer_length);
@@ -418,9 +516,12 @@ void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channe
     synth->other_channel = -1;
     synth->waveform_obj = waveform_obj;
     synth->sample_rate = sample_rate;
+    synth->sample_time = 0;
+    synth->events = NULL;
+    synth->event_count = 0;
     synthio_synth_envelope_set(synth, envelope_obj);
 
-    for (size_t i = 0; i < CIRCUITPY_SYNTHIO_MAX_CHANNELS; i++) {
+    for (size_t i = 0; i < synth->voice_count; i++) {
         synth->span.note_obj[i] = SYNTHIO_SILENCE;
     }
 }
@@ -453,8 +554,74 @@ void synthio_synth_parse_waveform(mp_buffer_info_t *bufinfo_waveform, mp_obj_t w
     parse_common(bufinfo_waveform, waveform_obj, MP_QSTR_waveform, SYNTHIO_WAVEFORM_SIZE);
 }
 
+// Half band lowpass, Blackman windowed sinc with 31 taps, in Q15. Only the odd
+// taps are non-zero apart from the center tap.
+STATIC const int16_t halfband_taps[] = {10266, -3012, 1392, -661, 288, -106, 28, -2};
+#define HALFBAND_CENTER_TAP (16382)
+#define MIPMAP_MIN_LENGTH (4)
+
+void synthio_mipmap_clear(synthio_mipmap_t *mipmap) {
+    mipmap->source = NULL;
+    mipmap->length = 0;
+    mipmap->levels = NULL;
+    mipmap->level_count = 0;
+}
+
+// Called while rendering, the first time a band limited note plays the
+// waveform. If there isn't enough memory the note is played without band
+// limiting and the build is tried again next time.
+void synthio_mipmap_build(synthio_mipmap_t *mipmap, const mp_buffer_info_t *bufinfo_waveform) {
+    uint32_t length = bufinfo_waveform->len;
+    if (mipmap->source == bufinfo_waveform->buf && mipmap->length == length) {
+        return;
+    }
+    synthio_mipmap_clear(mipmap);
+
+    uint8_t level_count = 0;
+    size_t total = 0;
+    for (uint32_t l = length; l % 2 == 0 && l / 2 >= MIPMAP_MIN_LENGTH; l /= 2) {
+        level_count++;
+        total += l / 2;
+    }
+    int16_t *levels = NULL;
+    if (level_count > 0) {
+        levels = m_malloc_maybe(total * sizeof(int16_t));
+        if (levels == NULL) {
+            return;
+        }
+    }
+
+    const int16_t *src = bufinfo_waveform->buf;
+    int16_t *dest = levels;
+    uint32_t src_length = length;
+    for (uint8_t level = 0; level < level_count; level++) {
+        // Lowpass at half the source's Nyquist frequency and keep every other
+        // sample. The waveform is one period so the filter wraps around.
+        uint32_t dest_length = src_length / 2;
+        for (uint32_t i = 0; i < dest_length; i++) {
+            uint32_t center = 2 * i;
+            int32_t acc = HALFBAND_CENTER_TAP * src[center];
+            for (size_t t = 0; t < MP_ARRAY_SIZE(halfband_taps); t++) {
+                uint32_t distance = (2 * t + 1) % src_length;
+                uint32_t before = (center + src_length - distance) % src_length;
+                uint32_t after = (center + distance) % src_length;
+                acc += halfband_taps[t] * (src[before] + src[after]);
+            }
+            acc = (acc + (1 << 14)) >> 15;
+            dest[i] = MIN(32767, MAX(-32768, acc));
+        }
+        src = dest;
+        dest += dest_length;
+        src_length = dest_length;
+    }
+    mipmap->source = bufinfo_waveform->buf;
+    mipmap->length = length;
+    mipmap->levels = levels;
+    mipmap->level_count = level_count;
+}
+
 STATIC int find_channel_with_note(synthio_synth_t *synth, mp_obj_t note) {
-    for (int i = 0; i < CIRCUITPY_SYNTHIO_MAX_CHANNELS; i++) {
+    for (int i = 0; i < synth->voice_count; i++) {
         if (synth->span.note_obj[i] == note) {
             return i;
         }
@@ -463,7 +630,7 @@ STATIC int find_channel_with_note(synthio_synth_t *synth, mp_obj_t note) {
     if (note == SYNTHIO_SILENCE) {
         // replace the releasing note with lowest volume level
         int level = 32768;
-        for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+        for (int chan = 0; chan < synth->voice_count; chan++) {
             if (!SYNTHIO_NOTE_IS_PLAYING(synth, chan)) {
                 synthio_envelope_state_t *state = &synth->envelope_state[chan];
                 if (state->level < level) {
@@ -472,6 +639,17 @@ STATIC int find_channel_with_note(synthio_synth_t *synth, mp_obj_t note) {
                 }
             }
         }
+        if (result == -1 && synth->voice_stealing) {
+            // every voice is held, so take the one pressed longest ago
+            uint32_t oldest = 0;
+            for (int chan = 0; chan < synth->voice_count; chan++) {
+                uint32_t age = synth->press_count - synth->press_order[chan];
+                if (result == -1 || age > oldest) {
+                    result = chan;
+                    oldest = age;
+                }
+            }
+        }
     }
     return result;
 }
@@ -481,6 +659,7 @@ bool synthio_span_change_note(synthio_synth_t *synth, mp_obj_t old_note, mp_obj_
     if (new_note != SYNTHIO_SILENCE && (channel = find_channel_with_note(synth, new_note)) != -1) {
         // note already playing, re-enter attack phase
         synth->envelope_state[channel].state = SYNTHIO_ENVELOPE_STATE_ATTACK;
+        synth->press_order[channel] = ++synth->press_count;
         return true;
     }
     channel = find_channel_with_note(synth, old_note);
@@ -491,12 +670,100 @@ bool synthio_span_change_note(synthio_synth_t *synth, mp_obj_t old_note, mp_obj_
             synth->span.note_obj[channel] = new_note;
             synthio_envelope_state_init(&synth->envelope_state[channel], synthio_synth_get_note_envelope(synth, new_note));
             synth->accum[channel] = 0;
+            synth->press_order[channel] = ++synth->press_count;
         }
         return true;
     }
     return false;
 }
 
+void synthio_synth_events_init(synthio_synth_t *synth) {
+    if (synth->events == NULL) {
+        synth->events = m_malloc(SYNTHIO_MAX_EVENTS * sizeof(synthio_event_t));
+    }
+}
+
+// Insert an event after any others for the same time, so that events take
+// effect in the order they were scheduled. Times compare modulo 2**32.
+// Returns false if the queue is full. Does not allocate, so it may be
+// called from the background task once synthio_synth_events_init was called.
+bool synthio_synth_schedule(synthio_synth_t *synth, uint32_t time, synthio_event_kind_t kind, mp_obj_t target, mp_obj_t value) {
+    if (synth->events == NULL || synth->event_count == SYNTHIO_MAX_EVENTS) {
+        return false;
+    }
+    int32_t offset = time - synth->sample_time;
+    size_t i = synth->event_count;
+    while (i > 0 && (int32_t)(synth->events[i - 1].time - synth->sample_time) > offset) {
+        i--;
+    }
+    memmove(&synth->events[i + 1], &synth->events[i], (synth->event_count - i) * sizeof(synthio_event_t));
+    synth->events[i] = (synthio_event_t) {
+        .time = time, .kind = kind, .target = target, .value = value
+    };
+    synth->event_count++;
+    return true;
+}
+
+void synthio_synth_apply_event(synthio_synth_t *synth, const synthio_event_t *event) {
+    mp_obj_t target = event->target;
+    if (event->kind == SYNTHIO_EVENT_RELEASE) {
+        int chan = find_channel_with_note(synth, target);
+        if (chan != -1 && SYNTHIO_NOTE_IS_PLAYING(synth, chan)) {
+            synthio_span_change_note(synth, target, SYNTHIO_SILENCE);
+            // Envelopes only step every SYNTHIO_MAX_DUR samples. Take the
+            // first release step now, so the release starts on this sample.
+            synthio_envelope_state_t *state = &synth->envelope_state[chan];
+            synthio_envelope_state_step(state, synthio_synth_get_note_envelope(synth, target), SYNTHIO_MAX_DUR - state->substep);
+        }
+        return;
+    }
+    if (event->kind == SYNTHIO_EVENT_PRESS) {
+        if (!mp_obj_is_small_int(target)) {
+            synthio_note_start(MP_OBJ_TO_PTR(target), synth->sample_rate);
+        }
+        synthio_span_change_note(synth, SYNTHIO_SILENCE, target);
+        return;
+    }
+    if (event->kind == SYNTHIO_EVENT_RETRIGGER) {
+        common_hal_synthio_lfo_retrigger(MP_OBJ_TO_PTR(target));
+        return;
+    }
+    // The values were validated when the event was scheduled, so none of
+    // these can raise.
+    synthio_note_obj_t *note = MP_OBJ_TO_PTR(target);
+    switch (event->kind) {
+        case SYNTHIO_EVENT_FREQUENCY:
+            common_hal_synthio_note_set_frequency(note, mp_obj_get_float(event->value));
+            break;
+        case SYNTHIO_EVENT_AMPLITUDE:
+            note->amplitude.obj = event->value;
+            break;
+        case SYNTHIO_EVENT_BEND:
+            note->bend.obj = event->value;
+            break;
+        case SYNTHIO_EVENT_PANNING:
+            note->panning.obj = event->value;
+            break;
+    }
+}
+
+// Apply every event whose time has come.
+void synthio_synth_run_events(synthio_synth_t *synth) {
+    size_t due = 0;
+    while (due < synth->event_count && (int32_t)(synth->events[due].time - synth->sample_time) <= 0) {
+        synthio_synth_apply_event(synth, &synth->events[due]);
+        due++;
+    }
+    if (due) {
+        synth->event_count -= due;
+        memmove(&synth->events[0], &synth->events[due], synth->event_count * sizeof(synthio_event_t));
+    }
+}
+
+void synthio_synth_clear_events(synthio_synth_t *synth) {
+    synth->event_count = 0;
+}
+
 uint64_t synthio_frequency_convert_float_to_scaled(mp_float_t val) {
     return round_float_to_int64(val * (1 << SYNTHIO_FREQUENCY_SHIFT));
 }
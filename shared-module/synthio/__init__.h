@@ -33,13 +33,15 @@
 #define SYNTHIO_NOTE_IS_SIMPLE(note) (mp_obj_is_small_int(note))
 #define SYNTHIO_NOTE_IS_PLAYING(synth, i) ((synth)->envelope_state[(i)].state != SYNTHIO_ENVELOPE_STATE_RELEASE)
 #define SYNTHIO_FREQUENCY_SHIFT (16)
+#define SYNTHIO_MAX_POLYPHONY (256)
+#define SYNTHIO_MAX_EVENTS (64)
 
 #include "shared-module/audiocore/__init__.h"
 #include "shared-bindings/synthio/__init__.h"
 
 typedef struct {
     uint16_t dur;
-    mp_obj_t note_obj[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
+    mp_obj_t *note_obj;
 } synthio_midi_span_t;
 
 typedef struct {
@@ -56,6 +58,37 @@ typedef struct {
     envelope_state_e state;
 } synthio_envelope_state_t;
 
+// Band limited copies of a waveform, each half the length of the one before,
+// so that high notes can be played from a table without harmonics above the
+// Nyquist frequency.
+typedef struct {
+    const int16_t *source;
+    uint32_t length;
+    // Level 1 (length / 2) then level 2 (length / 4) and so on.
+    int16_t *levels;
+    uint8_t level_count;
+} synthio_mipmap_t;
+
+typedef enum {
+    SYNTHIO_EVENT_RELEASE,
+    SYNTHIO_EVENT_PRESS,
+    SYNTHIO_EVENT_RETRIGGER,
+    SYNTHIO_EVENT_FREQUENCY,
+    SYNTHIO_EVENT_AMPLITUDE,
+    SYNTHIO_EVENT_BEND,
+    SYNTHIO_EVENT_PANNING,
+} synthio_event_kind_t;
+
+// A change that takes effect when the synthesizer reaches a given sample.
+// target is the note (or LFO, for a retrigger) and value is the already
+// validated new value for the parameter changes.
+typedef struct {
+    uint32_t time;
+    uint8_t kind;
+    mp_obj_t target;
+    mp_obj_t value;
+} synthio_event_t;
+
 typedef struct synthio_synth {
     uint32_t sample_rate;
     uint32_t total_envelope;
@@ -65,12 +98,24 @@ typedef struct synthio_synth {
     uint16_t last_buffer_length;
     uint8_t other_channel, buffer_index, other_buffer_index;
     mp_buffer_info_t waveform_bufinfo;
+    synthio_mipmap_t waveform_mipmap;
     synthio_envelope_definition_t global_envelope_definition;
     mp_obj_t waveform_obj, filter_obj, envelope_obj;
     synthio_midi_span_t span;
-    uint32_t accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
-    uint32_t ring_accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
-    synthio_envelope_state_t envelope_state[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
+    // Per voice state, voice_count entries each
+    uint16_t voice_count;
+    bool voice_stealing;
+    int32_t mix_down_scale;
+    uint32_t press_count;
+    uint32_t *accum;
+    uint32_t *ring_accum;
+    uint32_t *press_order;
+    synthio_envelope_state_t *envelope_state;
+    // Samples generated so far, wrapping at 2**32. Scheduled events are
+    // kept sorted by time and blocks are split at each event.
+    uint32_t sample_time;
+    synthio_event_t *events;
+    uint16_t event_count;
 } synthio_synth_t;
 
 typedef struct {
@@ -86,16 +131,24 @@ typedef struct {
 void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **buffer, uint32_t *buffer_length, uint8_t channel);
 void synthio_synth_deinit(synthio_synth_t *synth);
 bool synthio_synth_deinited(synthio_synth_t *synth);
-void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope);
+void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, int voice_count, bool voice_stealing, mp_obj_t waveform_obj, mp_obj_t envelope);
 void synthio_synth_get_buffer_structure(synthio_synth_t *synth, bool single_channel_output,
     bool *single_buffer, bool *samples_signed, uint32_t *max_buffer_length, uint8_t *spacing);
 void synthio_synth_reset_buffer(synthio_synth_t *synth, bool single_channel_output, uint8_t channel);
 void synthio_synth_parse_waveform(mp_buffer_info_t *bufinfo_waveform, mp_obj_t waveform_obj);
+void synthio_mipmap_build(synthio_mipmap_t *mipmap, const mp_buffer_info_t *bufinfo_waveform);
+void synthio_mipmap_clear(synthio_mipmap_t *mipmap);
 void synthio_synth_parse_filter(mp_buffer_info_t *bufinfo_filter, mp_obj_t filter_obj);
 void synthio_synth_parse_envelope(uint16_t *envelope_sustain_index, mp_buffer_info_t *bufinfo_envelope, mp_obj_t envelope_obj, mp_obj_t envelope_hold_obj);
 
 bool synthio_span_change_note(synthio_synth_t *synth, mp_obj_t old_note, mp_obj_t new_note);
 
+void synthio_synth_events_init(synthio_synth_t *synth);
+void synthio_synth_apply_event(synthio_synth_t *synth, const synthio_event_t *event);
+bool synthio_synth_schedule(synthio_synth_t *synth, uint32_t time, synthio_event_kind_t kind, mp_obj_t target, mp_obj_t value);
+void synthio_synth_run_events(synthio_synth_t *synth);
+void synthio_synth_clear_events(synthio_synth_t *synth);
+
 void synthio_envelope_step(synthio_envelope_definition_t *definition, synthio_envelope_state_t *state, int n_samples);
 void synthio_envelope_definition_set(synthio_envelope_definition_t *envelope, mp_obj_t obj, uint32_t sample_rate);
 
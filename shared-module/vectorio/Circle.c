@@ -5,6 +5,7 @@
 
 #include "py/runtime.h"
 #include "stdlib.h"
+#include <math.h>
 
 
 void common_hal_vectorio_circle_construct(vectorio_circle_t *self, uint16_t radius, uint16_t color_index) {
@@ -39,6 +40,33 @@ uint32_t common_hal_vectorio_circle_get_pixel(void *obj, int16_t x, int16_t y) {
     return pythagorasSmallerThanRadius ? self->color_index : 0;
 }
 
+uint16_t common_hal_vectorio_circle_get_spans(void *obj, int16_t y, int16_t x1, int16_t x2, vectorio_span_t *spans, uint16_t max_spans) {
+    vectorio_circle_t *self = obj;
+    int32_t radius = self->radius;
+    int32_t ay = abs(y);
+    if (ay > radius || max_spans == 0) {
+        return 0;
+    }
+    // Same coverage as get_pixel: the widest x with x * x + y * y <= radius * radius.
+    int32_t remainder = radius * radius - ay * ay;
+    int32_t half_width = (int32_t)sqrtf((float)remainder);
+    while (half_width * half_width > remainder) {
+        half_width--;
+    }
+    while ((half_width + 1) * (half_width + 1) <= remainder) {
+        half_width++;
+    }
+    int16_t start = MAX(x1, -half_width);
+    int16_t end = MIN(x2, half_width + 1);
+    if (start >= end) {
+        return 0;
+    }
+    spans[0].x1 = start;
+    spans[0].x2 = end;
+    spans[0].pixel = self->color_index;
+    return 1;
+}
+
 
 void common_hal_vectorio_circle_get_area(void *circle, displayio_area_t *out_area) {
     vectorio_circle_t *self = circle;
@@ -13,6 +13,47 @@
 // #define VECTORIO_POLYGON_DEBUG(...) mp_printf(&mp_plat_print, __VA_ARGS__)
 
 
+// Builds the scanline edge table: every non-horizontal edge sorted by its top row.
+static void _build_edge_table(vectorio_polygon_t *self) {
+    uint16_t point_count = self->len / 2;
+    self->edges = gc_realloc(self->edges, point_count * sizeof(vectorio_polygon_edge_t), true);
+    self->active_edges = gc_realloc(self->active_edges, point_count * sizeof(uint16_t), true);
+    self->crossings = gc_realloc(self->crossings, point_count * sizeof(vectorio_polygon_crossing_t), true);
+
+    uint16_t edge_count = 0;
+    for (uint16_t i = 0; i < point_count; ++i) {
+        uint16_t next = (i + 1) % point_count;
+        int16_t x1 = self->points_list[2 * i];
+        int16_t y1 = self->points_list[2 * i + 1];
+        int16_t x2 = self->points_list[2 * next];
+        int16_t y2 = self->points_list[2 * next + 1];
+        if (y1 == y2) {
+            // Horizontal edges never change the winding number.
+            continue;
+        }
+        vectorio_polygon_edge_t edge = {
+            .x1 = x1,
+            .y1 = y1,
+            .dx = x2 - x1,
+            .dy = y2 - y1,
+            .y_min = MIN(y1, y2),
+            .y_max = MAX(y1, y2),
+        };
+        // Insertion sort by y_min. Polygons are usually mostly in order already.
+        uint16_t j = edge_count;
+        while (j > 0 && self->edges[j - 1].y_min > edge.y_min) {
+            self->edges[j] = self->edges[j - 1];
+            --j;
+        }
+        self->edges[j] = edge;
+        ++edge_count;
+    }
+    self->edge_count = edge_count;
+    self->active_count = 0;
+    self->next_edge = 0;
+    self->active_y = SHRT_MIN;
+}
+
 // Converts a list of points tuples to a flat list of ints for speedier internal use.
 // Also validates the points. If this fails due to invalid types or values, the
 // number of points is 0 and the points_list is NULL.
@@ -51,6 +92,8 @@ static void _clobber_points_list(vectorio_polygon_t *self, mp_obj_t points_tuple
 
     self->points_list = points_list;
     self->len = 2 * len;
+
+    _build_edge_table(self);
 }
 
 
@@ -59,6 +102,10 @@ void common_hal_vectorio_polygon_construct(vectorio_polygon_t *self, mp_obj_t po
     VECTORIO_POLYGON_DEBUG("%p polygon_construct: ", self);
     self->points_list = NULL;
     self->len = 0;
+    self->edges = NULL;
+    self->active_edges = NULL;
+    self->crossings = NULL;
+    self->edge_count = 0;
     self->on_dirty.obj = NULL;
     self->color_index = color_index + 1;
     _clobber_points_list(self, points_list);
@@ -179,6 +226,105 @@ uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y)
     return winding_number == 0 ? 0 : self->color_index;
 }
 
+// Moves the active edge table to row y. Rows are usually visited in order so
+// edges are only added from the sorted edge table and dropped once passed.
+static void _update_active_edges(vectorio_polygon_t *self, int16_t y) {
+    if (y == self->active_y) {
+        return;
+    }
+    if (y < self->active_y) {
+        self->active_count = 0;
+        self->next_edge = 0;
+    }
+    self->active_y = y;
+
+    uint16_t kept = 0;
+    for (uint16_t i = 0; i < self->active_count; ++i) {
+        uint16_t edge = self->active_edges[i];
+        if (self->edges[edge].y_max > y) {
+            self->active_edges[kept++] = edge;
+        }
+    }
+    while (self->next_edge < self->edge_count && self->edges[self->next_edge].y_min <= y) {
+        if (self->edges[self->next_edge].y_max > y) {
+            self->active_edges[kept++] = self->next_edge;
+        }
+        ++self->next_edge;
+    }
+    self->active_count = kept;
+}
+
+// Rounds the fraction up, for any sign of numerator and denominator.
+static int32_t _ceil_div(int64_t numerator, int64_t denominator) {
+    if (denominator < 0) {
+        numerator = -numerator;
+        denominator = -denominator;
+    }
+    int64_t quotient = numerator / denominator;
+    if (numerator % denominator > 0) {
+        ++quotient;
+    }
+    return quotient;
+}
+
+// Produces the same coverage as get_pixel. Along row y, an upward edge adds one to
+// the winding number of every pixel strictly left of where it crosses the row and a
+// downward edge subtracts one. Sorting those crossings splits the row into runs of
+// constant winding number and the non-zero runs are the spans.
+uint16_t common_hal_vectorio_polygon_get_spans(void *obj, int16_t y, int16_t x1, int16_t x2, vectorio_span_t *spans, uint16_t max_spans) {
+    vectorio_polygon_t *self = obj;
+    if (self->len == 0 || max_spans == 0) {
+        return 0;
+    }
+    _update_active_edges(self, y);
+
+    vectorio_polygon_crossing_t *crossings = self->crossings;
+    uint16_t crossing_count = self->active_count;
+    int16_t winding_number = 0;
+    for (uint16_t i = 0; i < crossing_count; ++i) {
+        const vectorio_polygon_edge_t *edge = &self->edges[self->active_edges[i]];
+        // Pixels with x < x1 + (y - y1) * dx / dy are left of the edge.
+        vectorio_polygon_crossing_t crossing = {
+            .x = _ceil_div((int64_t)edge->x1 * edge->dy + (int64_t)(y - edge->y1) * edge->dx, edge->dy),
+            .winding = edge->dy > 0 ? 1 : -1,
+        };
+        winding_number += crossing.winding;
+        uint16_t j = i;
+        while (j > 0 && crossings[j - 1].x > crossing.x) {
+            crossings[j] = crossings[j - 1];
+            --j;
+        }
+        crossings[j] = crossing;
+    }
+
+    // winding_number starts as the winding number far to the left and each crossing
+    // removes its contribution as we move right past it.
+    uint16_t span_count = 0;
+    int32_t run_start = x1;
+    for (uint16_t i = 0; i <= crossing_count && run_start < x2; ++i) {
+        int32_t run_end = i < crossing_count ? crossings[i].x : x2;
+        run_end = MIN(run_end, x2);
+        if (winding_number != 0 && run_end > run_start) {
+            if (span_count > 0 && spans[span_count - 1].x2 == run_start) {
+                spans[span_count - 1].x2 = run_end;
+            } else {
+                if (span_count == max_spans) {
+                    break;
+                }
+                spans[span_count].x1 = run_start;
+                spans[span_count].x2 = run_end;
+                spans[span_count].pixel = self->color_index;
+                ++span_count;
+            }
+        }
+        run_start = MAX(run_start, run_end);
+        if (i < crossing_count) {
+            winding_number -= crossings[i].winding;
+        }
+    }
+    return span_count;
+}
+
 mp_obj_t common_hal_vectorio_polygon_get_draw_protocol(void *polygon) {
     vectorio_polygon_t *self = polygon;
     return self->draw_protocol_instance;
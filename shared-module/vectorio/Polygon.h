@@ -6,12 +6,38 @@
 #include "py/obj.h"
 #include "shared-module/vectorio/__init__.h"
 
+typedef struct {
+    int16_t x1;
+    int16_t y1;
+    int16_t dx;
+    int16_t dy;
+    // Rows [y_min, y_max) cross this edge.
+    int16_t y_min;
+    int16_t y_max;
+} vectorio_polygon_edge_t;
+
+typedef struct {
+    // The edge covers pixels left of x.
+    int16_t x;
+    int8_t winding;
+} vectorio_polygon_crossing_t;
+
 typedef struct {
     mp_obj_base_t base;
     // An int array[ x, y, ... ]
     int16_t *points_list;
     uint16_t len;
     uint16_t color_index;
+    // Scanline state. The edge table is sorted by y_min and is rebuilt as soon
+    // as the points change. The active edge table holds the edges crossing
+    // active_y and is moved along as rows are drawn.
+    vectorio_polygon_edge_t *edges;
+    uint16_t *active_edges;
+    vectorio_polygon_crossing_t *crossings;
+    uint16_t edge_count;
+    uint16_t active_count;
+    uint16_t next_edge;
+    int16_t active_y;
     vectorio_event_t on_dirty;
     mp_obj_t draw_protocol_instance;
 } vectorio_polygon_t;
@@ -27,6 +27,22 @@ uint32_t common_hal_vectorio_rectangle_get_pixel(void *obj, int16_t x, int16_t y
     return 0;
 }
 
+uint16_t common_hal_vectorio_rectangle_get_spans(void *obj, int16_t y, int16_t x1, int16_t x2, vectorio_span_t *spans, uint16_t max_spans) {
+    vectorio_rectangle_t *self = obj;
+    if (y < 0 || y >= self->height || max_spans == 0) {
+        return 0;
+    }
+    int16_t start = MAX(x1, 0);
+    int16_t end = MIN(x2, (int16_t)self->width);
+    if (start >= end) {
+        return 0;
+    }
+    spans[0].x1 = start;
+    spans[0].x2 = end;
+    spans[0].pixel = self->color_index;
+    return 1;
+}
+
 
 void common_hal_vectorio_rectangle_get_area(void *rectangle, displayio_area_t *out_area) {
     vectorio_rectangle_t *self = rectangle;
@@ -315,6 +315,70 @@ void common_hal_vectorio_vector_shape_set_pixel_shader(vectorio_vector_shape_t *
     common_hal_vectorio_vector_shape_set_dirty(self);
 }
 
+// Most vectorio shapes won't have more separate runs than this on a row. More
+// are handled by asking the shape again.
+#define VECTORIO_MAX_SPANS (8)
+
+static void _write_pixel(const _displayio_colorspace_t *colorspace, uint16_t linestride_px, uint32_t *buffer, uint16_t pixel_index, uint32_t pixel) {
+    if (colorspace->depth == 16) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", pixel);
+        *(((uint16_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth == 32) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", pixel);
+        *(((uint32_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth == 8) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", pixel);
+        *(((uint8_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth < 8) {
+        uint8_t pixels_per_byte = 8 / colorspace->depth;
+        // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+        if (!colorspace->pixels_in_byte_share_row) {
+            uint16_t row = pixel_index / linestride_px;
+            uint16_t col = pixel_index % linestride_px;
+            pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
+        }
+        uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
+        if (colorspace->reverse_pixels_in_byte) {
+            // Reverse the shift by subtracting it from the leftmost shift.
+            shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+        }
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", pixel, colorspace->depth);
+        ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= pixel << shift;
+    }
+}
+
+// True when every pixel of an uncovered run was already set by a layer above.
+static bool _run_is_masked(const uint32_t *mask, uint16_t pixel_index, int32_t step, int16_t count) {
+    for (int16_t i = 0; i < count; ++i, pixel_index += step) {
+        if ((mask[pixel_index / 32] & (1u << (pixel_index % 32))) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool _shade_pixel(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_pixel) {
+    output_pixel->pixel = 0;
+    output_pixel->opaque = true;
+    if (self->pixel_shader == mp_const_none) {
+        output_pixel->pixel = input_pixel->pixel;
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        displayio_colorconverter_convert(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    }
+    return output_pixel->opaque;
+}
+
+static bool _shader_dithers(vectorio_vector_shape_t *self) {
+    if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        return common_hal_displayio_palette_get_dither(self->pixel_shader);
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        return common_hal_displayio_colorconverter_get_dither(self->pixel_shader);
+    }
+    return false;
+}
+
 bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
     // Shape areas are relative to 0,0.  This will allow rotation about a known axis.
     //   The consequence is that the area reported by the shape itself is _relative_ to 0,0.
@@ -323,7 +387,7 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
     //   the shape_area (unshifted) space.
     #ifdef VECTORIO_PERF
     uint64_t start = common_hal_time_monotonic_ns();
-    uint64_t pixel_time = 0;
+    uint64_t span_time = 0;
     #endif
 
     if (self->hidden) {
@@ -343,7 +407,6 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
 
     bool full_coverage = displayio_area_equal(area, &overlap);
 
-    uint8_t pixels_per_byte = 8 / colorspace->depth;
     VECTORIO_SHAPE_DEBUG(" xy:(%3d %3d) tform:{x:%d y:%d dx:%d dy:%d scl:%d w:%d h:%d mx:%d my:%d tr:%d}",
         self->x, self->y,
         self->absolute_transform->x, self->absolute_transform->y, self->absolute_transform->dx, self->absolute_transform->dy, self->absolute_transform->scale,
@@ -351,111 +414,99 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
         );
 
     uint16_t linestride_px = displayio_area_width(area);
-    uint16_t line_dirty_offset_px = (overlap.y1 - area->y1) * linestride_px;
-    uint16_t column_dirty_offset_px = overlap.x1 - area->x1;
-    VECTORIO_SHAPE_DEBUG(", linestride:%3d line_offset:%3d col_offset:%3d depth:%2d ppb:%2d shape:%s",
-        linestride_px, line_dirty_offset_px, column_dirty_offset_px, colorspace->depth, pixels_per_byte, mp_obj_get_type_str(self->ishape.shape));
 
+    // Walk the overlap in shape rows so shapes can hand back whole spans. Shape rows
+    // are screen rows, or screen columns when transposed, and either axis may be
+    // mirrored. Stepping one pixel along a shape axis is a fixed step in the buffer.
+    int32_t x_step = self->absolute_transform->dx < 1 ? -1 : 1;
+    int32_t y_step = self->absolute_transform->dy < 1 ? -(int32_t)linestride_px : linestride_px;
+    if (self->absolute_transform->transpose_xy) {
+        int32_t swap = x_step;
+        x_step = y_step;
+        y_step = swap;
+    }
+    int16_t corner1_x, corner1_y, corner2_x, corner2_y;
+    screen_to_shape_coordinates(self, overlap.x1, overlap.y1, &corner1_x, &corner1_y);
+    screen_to_shape_coordinates(self, overlap.x2 - 1, overlap.y2 - 1, &corner2_x, &corner2_y);
+    int16_t shape_x1 = MIN(corner1_x, corner2_x);
+    int16_t shape_x2 = MAX(corner1_x, corner2_x) + 1;
+    int16_t shape_y1 = MIN(corner1_y, corner2_y);
+    int16_t shape_y2 = MAX(corner1_y, corner2_y) + 1;
+    // Buffer index of shape pixel (0, 0), which may be outside of the buffer.
+    int32_t origin = (overlap.y1 - area->y1) * linestride_px + (overlap.x1 - area->x1) - corner1_x * x_step - corner1_y * y_step;
+
+    VECTORIO_SHAPE_DEBUG(", linestride:%3d shape:{(%3d,%3d), (%3d,%3d)} steps:(%d,%d) depth:%2d ppb:%2d shape:%s",
+        linestride_px, shape_x1, shape_y1, shape_x2, shape_y2, x_step, y_step, colorspace->depth, 8 / colorspace->depth, mp_obj_get_type_str(self->ishape.shape));
+
+    bool dither = _shader_dithers(self);
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
+    input_pixel.x = input_pixel.y = input_pixel.tile = input_pixel.tile_x = input_pixel.tile_y = 0;
 
-    displayio_area_t shape_area;
-    self->ishape.get_area(self->ishape.shape, &shape_area);
-
-    uint16_t mask_start_px = line_dirty_offset_px;
-    for (input_pixel.y = overlap.y1; input_pixel.y < overlap.y2; ++input_pixel.y) {
-        mask_start_px += column_dirty_offset_px;
-        for (input_pixel.x = overlap.x1; input_pixel.x < overlap.x2; ++input_pixel.x) {
-            // Check the mask first to see if the pixel has already been set.
-            uint16_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
-            uint32_t *mask_doubleword = &(mask[pixel_index / 32]);
-            uint8_t mask_bit = pixel_index % 32;
-            VECTORIO_SHAPE_PIXEL_DEBUG("\n%p pixel_index: %5u mask_bit: %2u mask: "U32_TO_BINARY_FMT, self, pixel_index, mask_bit, U32_TO_BINARY(*mask_doubleword));
-            if ((*mask_doubleword & (1u << mask_bit)) != 0) {
-                VECTORIO_SHAPE_PIXEL_DEBUG(" masked");
-                continue;
-            }
-            output_pixel.pixel = 0;
-
-            // Cast input screen coordinates to shape coordinates to pick the pixel to draw
-            int16_t pixel_to_get_x;
-            int16_t pixel_to_get_y;
-            screen_to_shape_coordinates(self, input_pixel.x, input_pixel.y, &pixel_to_get_x, &pixel_to_get_y);
-
-            VECTORIO_SHAPE_PIXEL_DEBUG(" get_pixel %p (%3d, %3d) -> ( %3d, %3d )", self->ishape.shape, input_pixel.x, input_pixel.y, pixel_to_get_x, pixel_to_get_y);
+    vectorio_span_t spans[VECTORIO_MAX_SPANS];
+    for (int16_t shape_y = shape_y1; shape_y < shape_y2; ++shape_y) {
+        int32_t row_origin = origin + shape_y * y_step;
+        int16_t shape_x = shape_x1;
+        while (shape_x < shape_x2) {
             #ifdef VECTORIO_PERF
-            uint64_t pre_pixel = common_hal_time_monotonic_ns();
+            uint64_t pre_span = common_hal_time_monotonic_ns();
             #endif
-            input_pixel.pixel = self->ishape.get_pixel(self->ishape.shape, pixel_to_get_x, pixel_to_get_y);
+            uint16_t span_count = self->ishape.get_spans(self->ishape.shape, shape_y, shape_x, shape_x2, spans, VECTORIO_MAX_SPANS);
             #ifdef VECTORIO_PERF
-            uint64_t post_pixel = common_hal_time_monotonic_ns();
-            pixel_time += post_pixel - pre_pixel;
+            span_time += common_hal_time_monotonic_ns() - pre_span;
             #endif
-            VECTORIO_SHAPE_PIXEL_DEBUG(" -> %d", input_pixel.pixel);
 
-            // vectorio shapes use 0 to mean "area is not covered."
-            // We can skip all the rest of the work for this pixel if it's not currently covered by the shape.
-            if (input_pixel.pixel == 0) {
-                VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel; input area is not fully covered)");
-                full_coverage = false;
-            } else {
-                // Pixel is not transparent. Let's pull the pixel value index down to 0-base for more error-resistant palettes.
-                input_pixel.pixel -= 1;
-                output_pixel.opaque = true;
-
-                if (self->pixel_shader == mp_const_none) {
-                    output_pixel.pixel = input_pixel.pixel;
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
-                    displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
-                    displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
+            for (uint16_t i = 0; i < span_count; ++i) {
+                const vectorio_span_t *span = &spans[i];
+                VECTORIO_SHAPE_PIXEL_DEBUG("\n%p span y:%3d [%3d, %3d) -> %d", self, shape_y, span->x1, span->x2, span->pixel);
+                if (full_coverage && !_run_is_masked(mask, row_origin + shape_x * x_step, x_step, span->x1 - shape_x)) {
+                    // vectorio shapes leave pixels between spans uncovered.
+                    full_coverage = false;
                 }
-
-                // We double-check this to fast-path the case when a pixel is not covered by the shape & not call the color converter unnecessarily.
-                if (!output_pixel.opaque) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel from colorconverter; input area is not fully covered)");
+                // Pull the pixel value index down to 0-base for more error-resistant palettes.
+                input_pixel.pixel = span->pixel - 1;
+                if (!dither && !_shade_pixel(self, colorspace, &input_pixel, &output_pixel)) {
+                    VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel from pixel shader; input area is not fully covered)");
                     full_coverage = false;
                 }
-
-                *mask_doubleword |= 1u << mask_bit;
-                if (colorspace->depth == 16) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", output_pixel.pixel);
-                    *(((uint16_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 32) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", output_pixel.pixel);
-                    *(((uint32_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 8) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", output_pixel.pixel);
-                    *(((uint8_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth < 8) {
-                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
-                    if (!colorspace->pixels_in_byte_share_row) {
-                        uint16_t row = pixel_index / linestride_px;
-                        uint16_t col = pixel_index % linestride_px;
-                        pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
+                uint16_t pixel_index = row_origin + span->x1 * x_step;
+                for (int16_t x = span->x1; x < span->x2; ++x, pixel_index += x_step) {
+                    uint32_t *mask_doubleword = &(mask[pixel_index / 32]);
+                    uint32_t mask_bit = 1u << (pixel_index % 32);
+                    if ((*mask_doubleword & mask_bit) != 0) {
+                        continue;
                     }
-                    uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
-                    if (colorspace->reverse_pixels_in_byte) {
-                        // Reverse the shift by subtracting it from the leftmost shift.
-                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+                    if (dither) {
+                        // Dithering is keyed by screen position.
+                        input_pixel.x = input_pixel.tile_x = area->x1 + pixel_index % linestride_px;
+                        input_pixel.y = input_pixel.tile_y = area->y1 + pixel_index / linestride_px;
+                        if (!_shade_pixel(self, colorspace, &input_pixel, &output_pixel)) {
+                            full_coverage = false;
+                        }
                     }
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", output_pixel.pixel, colorspace->depth);
-                    ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= output_pixel.pixel << shift;
+                    *mask_doubleword |= mask_bit;
+                    _write_pixel(colorspace, linestride_px, buffer, pixel_index, output_pixel.pixel);
                 }
+                shape_x = span->x2;
+            }
+            if (span_count < VECTORIO_MAX_SPANS) {
+                break;
             }
         }
-        mask_start_px += linestride_px - column_dirty_offset_px;
+        if (full_coverage && !_run_is_masked(mask, row_origin + shape_x * x_step, x_step, shape_x2 - shape_x)) {
+            full_coverage = false;
+        }
     }
     #ifdef VECTORIO_PERF
     uint64_t end = common_hal_time_monotonic_ns();
     uint32_t pixels = (overlap.x2 - overlap.x1) * (overlap.y2 - overlap.y1);
-    VECTORIO_PERF("draw %16s -> shape:{%4dpx, %4.1fms,%9.1fpps fill}  shape_pixels:{%6.1fus total, %4.1fus/px}\n",
+    VECTORIO_PERF("draw %16s -> shape:{%4dpx, %4.1fms,%9.1fpps fill}  shape_spans:{%6.1fus total, %4.1fus/px}\n",
         mp_obj_get_type_str(self->ishape.shape),
         (overlap.x2 - overlap.x1) * (overlap.y2 - overlap.y1),
         (double)((end - start) / 1000000.0),
         (double)(MAX(1, pixels * (1000000000.0 / (end - start)))),
-        (double)(pixel_time / 1000.0),
-        (double)(pixel_time / 1000.0 / pixels)
+        (double)(span_time / 1000.0),
+        (double)(span_time / 1000.0 / pixels)
         );
     #endif
     VECTORIO_SHAPE_DEBUG(" -> pixels:%4d\n", (overlap.x2 - overlap.x1) * (overlap.y2 - overlap.y1));
@@ -8,9 +8,14 @@
 #include "py/obj.h"
 #include "shared-module/displayio/area.h"
 #include "shared-module/displayio/Palette.h"
+#include "shared-module/vectorio/__init__.h"
 
 typedef void get_area_function(mp_obj_t shape, displayio_area_t *out_area);
 typedef uint32_t get_pixel_function(mp_obj_t shape, int16_t x, int16_t y);
+// Fills spans with the covered runs of row y that fall within [x1, x2), left to right.
+// Returns the number of spans. When it equals max_spans there may be more spans
+// after the last one returned.
+typedef uint16_t get_spans_function(mp_obj_t shape, int16_t y, int16_t x1, int16_t x2, vectorio_span_t *spans, uint16_t max_spans);
 
 // This struct binds a shape's common Shape support functions (its vector shape interface)
 //   to its instance pointer.  We only check at construction time what the type of the
@@ -22,6 +27,7 @@ typedef struct {
     mp_obj_t shape;
     get_area_function *get_area;
     get_pixel_function *get_pixel;
+    get_spans_function *get_spans;
 } vectorio_ishape_t;
 
 typedef struct {
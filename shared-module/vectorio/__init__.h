@@ -10,5 +10,12 @@ typedef struct {
     event_function *event;
 } vectorio_event_t;
 
+// A run of covered pixels [x1, x2) within one row of a shape.
+typedef struct {
+    int16_t x1;
+    int16_t x2;
+    uint32_t pixel;
+} vectorio_span_t;
+
 
 #endif
@@ -47,4 +47,8 @@ bool filesystem_is_writable_by_usb(fs_user_mount_t *vfs);
 
 FATFS *filesystem_circuitpy(void);
 
+// Called when a buffered log file starts or stops waiting for its timed commit,
+// which is done by filesystem_background().
+void filesystem_log_pending(bool pending);
+
 #endif  // MICROPY_INCLUDED_SUPERVISOR_FILESYSTEM_H
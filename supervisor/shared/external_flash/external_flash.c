@@ -42,20 +42,29 @@
 
 #define NO_SECTOR_LOADED 0xFFFFFFFF
 
-// The currently cached sector in the cache, ram or flash based.
-static uint32_t current_sector;
-
 STATIC const external_flash_device possible_devices[] = {EXTERNAL_FLASH_DEVICES};
 #define EXTERNAL_FLASH_DEVICE_COUNT MP_ARRAY_SIZE(possible_devices)
 
 static const external_flash_device *flash_device = NULL;
 
-// Track which blocks (up to 32) in the current sector currently live in the
-// cache.
-static uint32_t dirty_mask;
-
-// Table of pointers to each cached block
-static uint8_t **flash_cache_table = NULL;
+// An erase sector with blocks written to it that have not reached the flash yet.
+// They are kept in RAM, or in the scratch sector at the end of the flash when
+// no RAM could be allocated at all, until the sector is flushed.
+typedef struct {
+    // The cached sector, or NO_SECTOR_LOADED.
+    uint32_t sector;
+    // Track which blocks (up to 32) in the sector currently live in the cache.
+    uint32_t dirty_mask;
+    // Table of pointers to each cached page, NULL when caching to scratch flash.
+    uint8_t **table;
+    // Value of cache_clock when the sector was last written.
+    uint32_t last_used;
+} cached_sector_t;
+
+static cached_sector_t cached_sectors[CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS];
+static uint32_t cache_clock;
+
+external_flash_stats_t external_flash_stats;
 
 // Wait until both the write enable and write in progress bits have cleared.
 static bool wait_for_flash_ready(void) {
@@ -151,7 +160,7 @@ static bool page_erased(uint32_t sector_address) {
     uint8_t full_buffer[FILESYSTEM_BLOCK_SIZE];
     if (read_flash(sector_address, full_buffer, FILESYSTEM_BLOCK_SIZE)) {
         for (uint16_t i = 0; i < FILESYSTEM_BLOCK_SIZE; i++) {
-            if (short_buffer[i] != 0xff) {
+            if (full_buffer[i] != 0xff) {
                 return false;
             }
         }
@@ -293,9 +302,11 @@ void supervisor_flash_init(void) {
 
     wait_for_flash_ready();
 
-    current_sector = NO_SECTOR_LOADED;
-    dirty_mask = 0;
-    flash_cache_table = NULL;
+    for (size_t i = 0; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; i++) {
+        cached_sectors[i].sector = NO_SECTOR_LOADED;
+        cached_sectors[i].dirty_mask = 0;
+        cached_sectors[i].table = NULL;
+    }
 }
 
 // The size of each individual block.
@@ -315,18 +326,15 @@ uint32_t supervisor_flash_get_block_count(void) {
 
 // Flush the cache that was written to the scratch portion of flash. Only used
 // when ram is tight.
-static bool flush_scratch_flash(void) {
-    if (current_sector == NO_SECTOR_LOADED) {
-        return true;
-    }
+static bool flush_scratch_flash(cached_sector_t *cache) {
     // First, copy out any blocks that we haven't touched from the sector we've
     // cached.
     bool copy_to_scratch_ok = true;
     uint32_t scratch_sector = flash_device->total_size - SPI_FLASH_ERASE_SIZE;
     for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
-        if ((dirty_mask & (1 << i)) == 0) {
+        if ((cache->dirty_mask & (1 << i)) == 0) {
             copy_to_scratch_ok = copy_to_scratch_ok &&
-                copy_block(current_sector + i * FILESYSTEM_BLOCK_SIZE,
+                copy_block(cache->sector + i * FILESYSTEM_BLOCK_SIZE,
                 scratch_sector + i * FILESYSTEM_BLOCK_SIZE);
         }
     }
@@ -336,11 +344,12 @@ static bool flush_scratch_flash(void) {
         return false;
     }
     // Second, erase the current sector.
-    erase_sector(current_sector);
+    erase_sector(cache->sector);
+    external_flash_stats.erases++;
     // Finally, copy the new version into it.
     for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
         copy_block(scratch_sector + i * FILESYSTEM_BLOCK_SIZE,
-            current_sector + i * FILESYSTEM_BLOCK_SIZE);
+            cache->sector + i * FILESYSTEM_BLOCK_SIZE);
     }
     return true;
 }
@@ -348,13 +357,13 @@ static bool flush_scratch_flash(void) {
 // Attempts to allocate a new set of page buffers for caching a full sector in
 // ram. Each page is allocated separately so that the GC doesn't need to provide
 // one huge block. We can free it as we write if we want to also.
-static bool allocate_ram_cache(void) {
+static bool allocate_ram_cache(cached_sector_t *cache) {
     uint8_t blocks_per_sector = SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE;
     uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
 
     uint32_t table_size = blocks_per_sector * pages_per_block * sizeof(size_t);
     // Attempt to allocate outside the heap first.
-    flash_cache_table = port_malloc(table_size, false);
+    uint8_t **flash_cache_table = port_malloc(table_size, false);
 
     // Declare i and j outside the loops in case we fail to allocate everything
     // we need. In that case we'll give it back.
@@ -372,7 +381,7 @@ static bool allocate_ram_cache(void) {
         }
     }
     // We couldn't allocate enough so give back what we got.
-    if (!success) {
+    if (!success && flash_cache_table != NULL) {
         // We add 1 so that we delete 0 when i is 1. Going to zero (i >= 0)
         // would never stop because i is unsigned.
         i++;
@@ -385,29 +394,71 @@ static bool allocate_ram_cache(void) {
         port_free(flash_cache_table);
         flash_cache_table = NULL;
     }
+    cache->table = flash_cache_table;
     return success;
 }
 
-static void release_ram_cache(void) {
+static void release_ram_cache(cached_sector_t *cache) {
     uint8_t blocks_per_sector = SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE;
     uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
     for (uint8_t i = 0; i < blocks_per_sector; i++) {
         for (uint8_t j = 0; j < pages_per_block; j++) {
             uint32_t offset = i * pages_per_block + j;
-            port_free(flash_cache_table[offset]);
+            port_free(cache->table[offset]);
         }
     }
-    port_free(flash_cache_table);
-    flash_cache_table = NULL;
+    port_free(cache->table);
+    cache->table = NULL;
 }
 
-// Flush the cached sector from ram onto the flash. We'll free the cache unless
-// keep_cache is true.
-static bool flush_ram_cache(bool keep_cache) {
-    if (current_sector == NO_SECTOR_LOADED) {
-        if (!keep_cache) {
-            release_ram_cache();
+// Returns true if every cached page can be written without erasing the sector,
+// which is the case when the page on the flash is fully erased or already holds
+// the same data, and sets a bit in changed_pages for each page that needs
+// programming. Programming a page a second time to clear more bits isn't
+// allowed on every part, for example ones with on-chip ECC, so a page that
+// holds other data always needs an erase.
+static bool sector_programmable(cached_sector_t *cache, uint32_t *changed_pages) {
+    uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
+    uint8_t buffer[SPI_FLASH_PAGE_SIZE];
+    *changed_pages = 0;
+    for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
+        if ((cache->dirty_mask & (1 << i)) == 0) {
+            continue;
         }
+        for (uint8_t j = 0; j < pages_per_block; j++) {
+            uint8_t page = i * pages_per_block + j;
+            const uint8_t *data = cache->table[page];
+            if (!read_flash(cache->sector + page * SPI_FLASH_PAGE_SIZE, buffer, SPI_FLASH_PAGE_SIZE)) {
+                return false;
+            }
+            if (memcmp(buffer, data, SPI_FLASH_PAGE_SIZE) == 0) {
+                continue;
+            }
+            // Devices without an erase command are written over directly anyway.
+            if (!flash_device->no_erase_cmd) {
+                for (uint16_t k = 0; k < SPI_FLASH_PAGE_SIZE; k++) {
+                    if (buffer[k] != 0xff) {
+                        return false;
+                    }
+                }
+            }
+            *changed_pages |= 1 << page;
+        }
+    }
+    return true;
+}
+
+// Flush the cached sector from ram onto the flash.
+static bool flush_ram_cache(cached_sector_t *cache) {
+    uint32_t changed_pages;
+    if (sector_programmable(cache, &changed_pages)) {
+        for (uint8_t page = 0; page < SPI_FLASH_ERASE_SIZE / SPI_FLASH_PAGE_SIZE; page++) {
+            if ((changed_pages & (1 << page)) != 0 &&
+                !write_flash(cache->sector + page * SPI_FLASH_PAGE_SIZE, cache->table[page], SPI_FLASH_PAGE_SIZE)) {
+                return false;
+            }
+        }
+        external_flash_stats.erases_avoided++;
         return true;
     }
     // First, copy out any blocks that we haven't touched from the sector
@@ -416,11 +467,11 @@ static bool flush_ram_cache(bool keep_cache) {
     bool copy_to_ram_ok = true;
     uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
     for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
-        if ((dirty_mask & (1 << i)) == 0) {
+        if ((cache->dirty_mask & (1 << i)) == 0) {
             for (uint8_t j = 0; j < pages_per_block; j++) {
                 copy_to_ram_ok = read_flash(
-                    current_sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
-                    flash_cache_table[i * pages_per_block + j],
+                    cache->sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
+                    cache->table[i * pages_per_block + j],
                     SPI_FLASH_PAGE_SIZE);
                 if (!copy_to_ram_ok) {
                     break;
@@ -436,35 +487,48 @@ static bool flush_ram_cache(bool keep_cache) {
         return false;
     }
     // Second, erase the current sector.
-    erase_sector(current_sector);
+    erase_sector(cache->sector);
+    external_flash_stats.erases++;
     // Lastly, write all the data in ram that we've cached.
     for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
         for (uint8_t j = 0; j < pages_per_block; j++) {
-            write_flash(current_sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
-                flash_cache_table[i * pages_per_block + j],
+            write_flash(cache->sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
+                cache->table[i * pages_per_block + j],
                 SPI_FLASH_PAGE_SIZE);
         }
     }
-    // We're done with the cache for now so give it back.
-    if (!keep_cache) {
-        release_ram_cache();
-    }
     return true;
 }
 
-// Delegates to the correct flash flush method depending on the existing cache.
+// Write a cached sector back to the flash. We'll free its ram unless keep_cache
+// is true.
+static bool flush_cached_sector(cached_sector_t *cache, bool keep_cache) {
+    bool ok = true;
+    if (cache->sector != NO_SECTOR_LOADED) {
+        // If we've cached to the flash itself flush from there.
+        if (cache->table == NULL) {
+            ok = flush_scratch_flash(cache);
+        } else {
+            ok = flush_ram_cache(cache);
+        }
+        cache->sector = NO_SECTOR_LOADED;
+        cache->dirty_mask = 0;
+    }
+    if (!keep_cache && cache->table != NULL) {
+        release_ram_cache(cache);
+    }
+    return ok;
+}
+
+// Flushes every cached sector.
 // TODO Don't blink the status indicator if we don't actually do any writing (hard to tell right now).
 static void spi_flash_flush_keep_cache(bool keep_cache) {
     #ifdef MICROPY_HW_LED_MSC
     port_pin_set_output_level(MICROPY_HW_LED_MSC, true);
     #endif
-    // If we've cached to the flash itself flush from there.
-    if (flash_cache_table == NULL) {
-        flush_scratch_flash();
-    } else {
-        flush_ram_cache(keep_cache);
+    for (size_t i = 0; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; i++) {
+        flush_cached_sector(&cached_sectors[i], keep_cache);
     }
-    current_sector = NO_SECTOR_LOADED;
     #ifdef MICROPY_HW_LED_MSC
     port_pin_set_output_level(MICROPY_HW_LED_MSC, false);
     #endif
@@ -478,6 +542,62 @@ void supervisor_flash_release_cache(void) {
     spi_flash_flush_keep_cache(false);
 }
 
+static cached_sector_t *find_cached_sector(uint32_t sector) {
+    for (size_t i = 0; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; i++) {
+        if (cached_sectors[i].sector == sector) {
+            return &cached_sectors[i];
+        }
+    }
+    return NULL;
+}
+
+// Pick a cache entry for a sector that isn't cached yet. Sectors stay cached
+// until they are flushed or the entry is needed for another sector, so blocks
+// written to several sectors in turn don't each cost an erase.
+static cached_sector_t *claim_cached_sector(uint32_t sector) {
+    cached_sector_t *cache = NULL;
+    // An unused entry that already has its ram, or can get it.
+    for (size_t i = 0; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS && cache == NULL; i++) {
+        if (cached_sectors[i].sector == NO_SECTOR_LOADED && cached_sectors[i].table != NULL) {
+            cache = &cached_sectors[i];
+        }
+    }
+    for (size_t i = 0; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS && cache == NULL; i++) {
+        if (cached_sectors[i].sector == NO_SECTOR_LOADED && allocate_ram_cache(&cached_sectors[i])) {
+            cache = &cached_sectors[i];
+        }
+    }
+    // Otherwise write back the least recently used sector and take its place.
+    if (cache == NULL) {
+        for (size_t i = 0; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; i++) {
+            if (cached_sectors[i].sector != NO_SECTOR_LOADED &&
+                (cache == NULL || cached_sectors[i].last_used - cache->last_used > UINT32_MAX / 2)) {
+                cache = &cached_sectors[i];
+            }
+        }
+        if (cache != NULL) {
+            #ifdef MICROPY_HW_LED_MSC
+            port_pin_set_output_level(MICROPY_HW_LED_MSC, true);
+            #endif
+            flush_cached_sector(cache, true);
+            #ifdef MICROPY_HW_LED_MSC
+            port_pin_set_output_level(MICROPY_HW_LED_MSC, false);
+            #endif
+        }
+    }
+    // Nothing is cached and there is no ram, so use the scratch sector.
+    if (cache == NULL) {
+        cache = &cached_sectors[0];
+    }
+    if (cache->table == NULL && !allocate_ram_cache(cache)) {
+        erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
+        wait_for_flash_ready();
+    }
+    cache->sector = sector;
+    cache->dirty_mask = 0;
+    return cache;
+}
+
 static int32_t convert_block_to_flash_addr(uint32_t block) {
     if (0 <= block && block < supervisor_flash_get_block_count()) {
         // a block in partition 1
@@ -498,13 +618,14 @@ static bool external_flash_read_block(uint8_t *dest, uint32_t block) {
     uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
     uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE);
     uint8_t mask = 1 << (block_index);
-    // We're reading from the currently cached sector.
-    if (current_sector == this_sector && (mask & dirty_mask) > 0) {
-        if (flash_cache_table != NULL) {
+    cached_sector_t *cache = find_cached_sector(this_sector);
+    // We're reading from a cached sector.
+    if (cache != NULL && (mask & cache->dirty_mask) > 0) {
+        if (cache->table != NULL) {
             uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
             for (int i = 0; i < pages_per_block; i++) {
                 memcpy(dest + i * SPI_FLASH_PAGE_SIZE,
-                    flash_cache_table[block_index * pages_per_block + i],
+                    cache->table[block_index * pages_per_block + i],
                     SPI_FLASH_PAGE_SIZE);
             }
             return true;
@@ -529,30 +650,29 @@ static bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
     uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE);
     uint8_t mask = 1 << (block_index);
-    // Flush the cache if we're moving onto a sector or we're writing the
-    // same block again.
-    if (current_sector != this_sector || (mask & dirty_mask) > 0) {
+    cached_sector_t *cache = find_cached_sector(this_sector);
+    // A block in the scratch sector can't be written again without erasing it,
+    // so flush the sector if we're writing the same block again.
+    if (cache != NULL && cache->table == NULL && (mask & cache->dirty_mask) > 0) {
+        flush_cached_sector(cache, true);
+        cache = NULL;
+    }
+    if (cache == NULL) {
         // Check to see if we'd write to an erased page. In that case we
         // can write directly.
         if (page_erased(address)) {
+            external_flash_stats.direct_writes++;
             return write_flash(address, data, FILESYSTEM_BLOCK_SIZE);
         }
-        if (current_sector != NO_SECTOR_LOADED) {
-            supervisor_flash_flush();
-        }
-        if (flash_cache_table == NULL && !allocate_ram_cache()) {
-            erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
-            wait_for_flash_ready();
-        }
-        current_sector = this_sector;
-        dirty_mask = 0;
+        cache = claim_cached_sector(this_sector);
     }
-    dirty_mask |= mask;
+    cache->dirty_mask |= mask;
+    cache->last_used = ++cache_clock;
     // Copy the block to the appropriate cache.
-    if (flash_cache_table != NULL) {
+    if (cache->table != NULL) {
         uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
         for (int i = 0; i < pages_per_block; i++) {
-            memcpy(flash_cache_table[block_index * pages_per_block + i],
+            memcpy(cache->table[block_index * pages_per_block + i],
                 data + i * SPI_FLASH_PAGE_SIZE,
                 SPI_FLASH_PAGE_SIZE);
         }
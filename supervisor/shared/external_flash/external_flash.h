@@ -47,6 +47,18 @@
 
 void supervisor_external_flash_flush(void);
 
+typedef struct {
+    // Sectors erased to write cached blocks back.
+    uint32_t erases;
+    // Cached sectors written back without an erase, because each changed page
+    // was still erased on the flash.
+    uint32_t erases_avoided;
+    // Blocks written straight to erased flash without caching.
+    uint32_t direct_writes;
+} external_flash_stats_t;
+
+extern external_flash_stats_t external_flash_stats;
+
 // Configure anything that needs to get set up before the external flash
 // is init'ed. For example, if GPIO needs to be configured to enable the
 // flash chip, as is the case on some boards.
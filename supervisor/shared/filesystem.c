@@ -34,6 +34,7 @@
 
 #include "supervisor/flash.h"
 #include "supervisor/linker.h"
+#include "supervisor/shared/tick.h"
 
 static mp_vfs_mount_t _mp_vfs;
 static fs_user_mount_t _internal_vfs;
@@ -48,6 +49,18 @@ void filesystem_background(void) {
         supervisor_flash_flush();
         filesystem_flush_requested = false;
     }
+    #if MICROPY_VFS_FAT_LOG
+    vfs_fat_log_background();
+    #endif
+}
+
+void filesystem_log_pending(bool pending) {
+    // Ticks run filesystem_background() while any log file has records waiting.
+    if (pending) {
+        supervisor_enable_tick();
+    } else {
+        supervisor_disable_tick();
+    }
 }
 
 inline void filesystem_tick(void) {
@@ -35,6 +35,10 @@ void filesystem_tick(void) {
     return;
 }
 
+void filesystem_log_pending(bool pending) {
+    (void)pending;
+}
+
 bool filesystem_init(bool create_allowed, bool force_create) {
     (void)create_allowed;
     (void)force_create;
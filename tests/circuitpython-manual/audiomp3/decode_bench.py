@@ -0,0 +1,66 @@
+# Measure how fast MP3Decoder decodes, without playing anything. Run it on a
+# board from this directory or with the path to an mp3 file as the first
+# argument.
+#
+# audiocore.render runs background tasks between the blocks it reads, the
+# same as time.sleep does, so frames are decoded ahead just as they would be
+# during playback.
+#
+# The first pass renders the whole file as fast as it can. "realtime" is how
+# many times faster than playback the file decodes, including any frames
+# decoded ahead. Below about 2, playback is likely to skip when anything else
+# is going on.
+#
+# The second pass paces rendering like playback: after each block it sleeps
+# until that block would have finished playing. "busy" is the fraction of the
+# playback time spent in render, which falls as decoding moves into the
+# background, and "underruns" counts the frames that weren't decoded ahead in
+# time.
+import sys
+import time
+
+import audiocore
+import audiomp3
+
+try:
+    filename = sys.argv[1]
+except (AttributeError, IndexError):
+    filename = "../audiocore/jeplayer-splash-44100-stereo.mp3"
+
+buf = bytearray(8192)
+
+
+def render_all(mp3, paced):
+    total = 0
+    busy = 0
+    t0 = time.monotonic_ns()
+    ended = False
+    reset = True
+    while not ended:
+        t = time.monotonic_ns()
+        written, ended = audiocore.render(mp3, buf, reset=reset)
+        busy += time.monotonic_ns() - t
+        reset = False
+        total += written
+        if paced:
+            played = total // 2 // mp3.channel_count * 1_000_000_000 // mp3.sample_rate
+            wait = t0 + played - time.monotonic_ns()
+            if wait > 0:
+                time.sleep(wait / 1e9)
+    return total // 2 // mp3.channel_count, busy / 1e9, (time.monotonic_ns() - t0) / 1e9
+
+
+for decode_ahead in (0, 2, 4):
+    with audiomp3.MP3Decoder(filename, decode_ahead=decode_ahead) as mp3:
+        samples, busy, dt = render_all(mp3, False)
+        print(
+            "decode_ahead={} samples={} time={:.3f}s realtime={:.1f}".format(
+                decode_ahead, samples, dt, samples / mp3.sample_rate / dt
+            )
+        )
+        samples, busy, dt = render_all(mp3, True)
+        print(
+            "decode_ahead={} paced time={:.3f}s busy={:.2f} underruns={}".format(
+                decode_ahead, dt, busy / dt, mp3.underruns
+            )
+        )
@@ -0,0 +1,60 @@
+# Time os.getenv() on a large settings.toml held in a RAM filesystem. Run it on
+# a unix coverage build; on a board it would unmount CIRCUITPY.
+#
+# Keys are looked up twice: once by name, which can use the cached index of
+# the file, and once through an equivalent key containing a space, which
+# always scans the file from the top.
+import os
+import time
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+
+    def readblocks(self, block, buf, off=0):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        buf[:] = self.data[addr : addr + len(buf)]
+
+    def writeblocks(self, block, buf, off=None):
+        addr = block * self.ERASE_BLOCK_SIZE + (off or 0)
+        self.data[addr : addr + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # block size
+            return self.ERASE_BLOCK_SIZE
+        if op == 6:  # erase block
+            return 0
+
+
+os.umount("/")
+bdev = RAMBlockDevice(512)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/")
+
+NKEYS = 40
+with open("/settings.toml", "w") as f:
+    f.write("# " + "padding " * 400 + "\n")
+    for i in range(NKEYS):
+        f.write(f'key{i} = "{"v" * 60}{i}"\n')
+        f.write(f'key {i} = "{"v" * 60}{i}"\n')
+
+REPEAT = 50
+
+
+def bench(fmt, i):
+    key = fmt.format(i)
+    t0 = time.ticks_us()
+    for _ in range(REPEAT):
+        os.getenv(key)
+    return time.ticks_diff(time.ticks_us(), t0) // REPEAT
+
+
+print("size", os.stat("/settings.toml")[6], "bytes")
+print("key    indexed_us  scanned_us")
+for i in (0, NKEYS // 2, NKEYS - 1):
+    print(f"{i:<6} {bench('key{}', i):>10} {bench('key {}', i):>11}")
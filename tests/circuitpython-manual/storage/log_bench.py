@@ -0,0 +1,64 @@
+# Compare appending small records to a plain file with appending them to a log
+# file, open(path, "a", buffering=n), on a FAT filesystem in RAM. Prints the
+# records written per second and the blocks written to the device per record.
+#
+# Runs on a unix build or on a board; the RAM disk is mounted at /ramdisk.
+import os
+import time
+
+
+class RAMBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+        self.writes = 0
+
+    def readblocks(self, n, buf):
+        start = n * self.SEC_SIZE
+        buf[:] = memoryview(self.data)[start : start + len(buf)]
+
+    def writeblocks(self, n, buf):
+        self.writes += len(buf) // self.SEC_SIZE
+        start = n * self.SEC_SIZE
+        self.data[start : start + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+RECORDS = 1000
+
+bdev = RAMBlockDevice(256)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/ramdisk")
+
+
+def run(label, buffering=-1, flush=False):
+    try:
+        os.remove("/ramdisk/log.csv")
+    except OSError:
+        pass
+    bdev.writes = 0
+    t0 = time.monotonic_ns() if hasattr(time, "monotonic_ns") else time.ticks_us() * 1000
+    with open("/ramdisk/log.csv", "a", buffering=buffering) as f:
+        for i in range(RECORDS):
+            f.write("%d,%d,%d\n" % (i, i * 37 % 1000, i * 91 % 1000))
+            if flush:
+                f.flush()
+    t1 = time.monotonic_ns() if hasattr(time, "monotonic_ns") else time.ticks_us() * 1000
+    print(
+        "%-28s %8d records/s %6.2f blocks/record"
+        % (label, RECORDS * 1_000_000_000 // max(1, t1 - t0), bdev.writes / RECORDS)
+    )
+
+
+run("open('a'), flush per record", flush=True)
+run("open('a')")
+for size in (512, 2048, 8192):
+    run("open('a', buffering=%d)" % size, buffering=size)
+
+os.umount("/ramdisk")
@@ -0,0 +1,40 @@
+import array
+import audiocore
+import audiomixer
+import io
+import synthio
+
+s = synthio.Synthesizer(sample_rate=8000)
+s.press(60)
+buf = array.array("h", [0] * 1000)
+print(audiocore.render(s, buf))
+print(buf[:8])
+print(audiocore.render(s, buf, length=512))
+f = io.BytesIO()
+print(audiocore.render(s, f, length=1000), len(f.getvalue()))
+
+raw = audiocore.RawSample(array.array("h", range(10)))
+print(audiocore.render(raw, buf))
+print(buf[:10])
+try:
+    audiocore.render(raw, bytearray(4))
+except ValueError as e:
+    print(e)
+f = io.BytesIO()
+print(audiocore.render(raw, f))
+print(f.getvalue())
+# length is rounded down to whole 16-bit samples
+f = io.BytesIO()
+print(audiocore.render(raw, f, length=7, reset=True))
+print(f.getvalue())
+
+m = audiomixer.Mixer(voice_count=1, sample_rate=8000, channel_count=1, bits_per_sample=16, samples_signed=True, buffer_size=64)
+m.voice[0].play(raw, loop=True)
+buf = array.array("h", [0] * 40)
+print(audiocore.render(m, buf))
+print(buf)
+
+try:
+    audiocore.render(1, buf)
+except TypeError as e:
+    print(e)
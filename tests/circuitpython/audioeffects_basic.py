@@ -0,0 +1,92 @@
+import array
+import audiocore
+import audioeffects
+import audiomixer
+import math
+
+# An impulse through a delay repeats every delay_ms, halving each time.
+imp = array.array("h", [16000] + [0] * 799)
+d = audioeffects.Delay(audiocore.RawSample(imp, sample_rate=8000), delay_ms=10, feedback=0.5)
+print(d.delay_ms, d.feedback, d.mix)
+buf = array.array("h", [0] * 800)
+print(audiocore.render(d, buf))
+print([(i, buf[i]) for i in range(len(buf)) if buf[i]])
+
+# Restarting the source clears the delay line.
+audiocore.render(d, buf, reset=True)
+print([(i, buf[i]) for i in range(len(buf)) if buf[i]][:3])
+
+# Once the source ends, the echoes carry on until they have died away.
+buf = array.array("h", [0] * 8000)
+written, done = audiocore.render(d, buf, reset=True)
+print(800 < written // 2 < 8000, done)
+print([(i, buf[i]) for i in range(800, len(buf)) if buf[i]])
+
+# The delay can't be set beyond the line allocated for it.
+try:
+    d.delay_ms = 600
+except ValueError as e:
+    print(e)
+print(d.delay_ms)
+
+# max_delay_ms need not be a whole number.
+d2 = audioeffects.Delay(audiocore.RawSample(imp), delay_ms=2.25, max_delay_ms=2.5)
+d2.delay_ms = 2.5
+print(d2.delay_ms)
+
+# 8 bit unsigned stereo sources are converted to signed 16 bit.
+d = audioeffects.Delay(
+    audiocore.RawSample(array.array("B", [255, 0] + [128] * 38), channel_count=2, sample_rate=8000),
+    delay_ms=1,
+    max_delay_ms=2,
+    feedback=0,
+)
+buf = array.array("h", [0] * 80)
+print(audiocore.render(d, buf))
+print([(i, buf[i]) for i in range(len(buf)) if buf[i]])
+
+sine = array.array("h", [int(16000 * math.sin(2 * math.pi * i / 40)) for i in range(8000)])
+
+# A sustained tone through a fully wet reverb comes out at a similar level.
+r = audioeffects.Reverb(audiocore.RawSample(sine, sample_rate=8000), room_size=0.8, mix=1.0)
+print(r.room_size, r.damping, r.mix)
+buf = array.array("h", [0] * 8000)
+audiocore.render(r, buf)
+print(8000 < max(buf[4000:]) < 16000, -16000 < min(buf[4000:]) < -8000)
+
+# A reverb's tail rings on past the end of a short burst, then ends.
+r = audioeffects.Reverb(audiocore.RawSample(sine[:400], sample_rate=8000), room_size=0.8, mix=1.0)
+buf = array.array("h", [0] * 30000)
+written, done = audiocore.render(r, buf)
+print(max(buf[1000:2000]) > 1000, 2000 < written // 2 < 30000, done)
+
+# A chorus on a stereo source, played through a mixer voice.
+c = audioeffects.Chorus(
+    audiocore.RawSample(sine, channel_count=2, sample_rate=8000), delay_ms=5, depth_ms=2, rate=2
+)
+print(c.delay_ms, c.depth_ms, c.rate, c.mix)
+m = audiomixer.Mixer(voice_count=1, channel_count=2, sample_rate=8000, buffer_size=1024)
+m.voice[0].play(c)
+buf = array.array("h", [0] * 8000)
+audiocore.render(m, buf)
+print(max(buf) <= 16000, min(buf) >= -16000, max(buf) > 10000)
+
+c.depth_ms = 1000
+print(c.depth_ms)
+
+for kw in ({"feedback": 2}, {"delay_ms": 600}, {"mix": -1}):
+    try:
+        audioeffects.Delay(audiocore.RawSample(imp), **kw)
+    except ValueError as e:
+        print(e)
+
+try:
+    audioeffects.Delay(1)
+except TypeError as e:
+    print(type(e))
+
+c.deinit()
+try:
+    c.rate
+except ValueError as e:
+    print(e)
@@ -0,0 +1,61 @@
+import array
+import audiocore
+import audiomixer
+
+
+def mix(sample, typecode="h", **kw):
+    m = audiomixer.Mixer(voice_count=2, buffer_size=64, **kw)
+    m.voice[0].play(sample)
+    buf = array.array(typecode, [0] * 32)
+    audiocore.render(m, buf)
+    print(list(buf[:16]))
+
+
+ramp = array.array("h", [i * 1000 for i in range(8)])
+
+# Matching format is mixed directly.
+mix(audiocore.RawSample(ramp, sample_rate=8000), channel_count=1, sample_rate=8000)
+
+# 8 bit unsigned source into a 16 bit signed mixer.
+mix(
+    audiocore.RawSample(array.array("B", [128, 192, 255, 64, 0]), sample_rate=8000),
+    channel_count=1,
+    sample_rate=8000,
+)
+
+# 16 bit mono source into an 8 bit signed stereo mixer.
+mix(
+    audiocore.RawSample(ramp, sample_rate=8000),
+    "b",
+    channel_count=2,
+    bits_per_sample=8,
+    sample_rate=8000,
+)
+
+# Stereo source into a mono mixer averages the channels.
+mix(
+    audiocore.RawSample(array.array("h", [1000, 3000, -2000, 0]), channel_count=2, sample_rate=8000),
+    channel_count=1,
+    sample_rate=8000,
+)
+
+# Upsampling by two interpolates between source frames.
+mix(audiocore.RawSample(ramp, sample_rate=4000), channel_count=1, sample_rate=8000)
+
+# Downsampling by two skips every other frame.
+mix(audiocore.RawSample(ramp, sample_rate=16000), channel_count=1, sample_rate=8000)
+
+# Voices are summed in 32 bits and clipped once at the end.
+m = audiomixer.Mixer(voice_count=3, buffer_size=64, channel_count=1, sample_rate=8000)
+loud = array.array("h", [30000, -30000, 30000, -30000])
+m.voice[0].play(audiocore.RawSample(loud, sample_rate=8000))
+m.voice[1].play(audiocore.RawSample(loud, sample_rate=8000))
+m.voice[2].play(audiocore.RawSample(array.array("h", [-30000, 30000, -30000, 30000])))
+buf = array.array("h", [0] * 16)
+audiocore.render(m, buf)
+print(list(buf[:4]))
+
+try:
+    m.voice[0].play(audiocore.RawSample(ramp, sample_rate=8000 * 300))
+except ValueError as e:
+    print(e)
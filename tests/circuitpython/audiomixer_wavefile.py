@@ -0,0 +1,89 @@
+# Play several WaveFiles at once through a Mixer and count how many block
+# device reads each second of audio needs, with the default buffers and with
+# larger read-ahead buffers. The exact counts depend on FatFs, so only check
+# that larger buffers need fewer reads and play the same audio.
+
+import array
+import audiocore
+import audiomixer
+import os
+import struct
+
+
+class RAMBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+        self.reads = 0
+
+    def readblocks(self, n, buf):
+        self.reads += 1
+        start = n * self.SEC_SIZE
+        buf[:] = memoryview(self.data)[start : start + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        start = n * self.SEC_SIZE
+        self.data[start : start + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+SAMPLE_RATE = 8000
+VOICES = 4
+
+bdev = RAMBlockDevice(400)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/ramdisk")
+
+for v in range(VOICES):
+    data = array.array("h", [(i % 100) * (v + 1) for i in range(SAMPLE_RATE)])
+    with open("/ramdisk/%d.wav" % v, "wb") as f:
+        f.write(b"RIFF")
+        f.write(struct.pack("<I", 36 + len(data) * 2))
+        f.write(b"WAVEfmt ")
+        f.write(struct.pack("<IHHIIHH", 16, 1, 1, SAMPLE_RATE, SAMPLE_RATE * 2, 2, 16))
+        f.write(b"data")
+        f.write(struct.pack("<I", len(data) * 2))
+        f.write(data)
+
+
+def play(buffer_size):
+    mixer = audiomixer.Mixer(
+        voice_count=VOICES, sample_rate=SAMPLE_RATE, channel_count=1, buffer_size=1024
+    )
+    waves = []
+    for v in range(VOICES):
+        if buffer_size:
+            w = audiocore.WaveFile("/ramdisk/%d.wav" % v, bytearray(buffer_size))
+        else:
+            w = audiocore.WaveFile("/ramdisk/%d.wav" % v)
+        waves.append(w)
+        mixer.voice[v].play(w)
+    buf = array.array("h", [0] * 256)
+    bdev.reads = 0
+    frames = 0
+    total = 0
+    while mixer.playing:
+        audiocore.render(mixer, buf)
+        frames += len(buf)
+        total += sum(buf)
+    for w in waves:
+        w.deinit()
+    return bdev.reads * SAMPLE_RATE // frames, total
+
+
+previous_reads, default_total = play(0)
+print("sum:", default_total)
+for buffer_size in (1024, 8192):
+    reads, total = play(buffer_size)
+    print(buffer_size, "same audio:", total == default_total, "fewer reads:", reads < previous_reads)
+    previous_reads = reads
+
+os.umount("/ramdisk")
@@ -0,0 +1,79 @@
+# Check bitmaptools.readinto against a straightforward decoding of the same
+# file data, for layouts that can be read straight into the bitmap and for
+# ones that need converting.
+
+import io
+import bitmaptools
+import displayio
+
+
+def expected_pixels(data, width, height, bits_per_pixel, element_size, reverse_pixels, swap_bytes, reverse_rows, bits_per_value):
+    elements_per_row = (width * bits_per_pixel + element_size * 8 - 1) // (element_size * 8)
+    rowsize = element_size * elements_per_row
+    mask = (1 << bits_per_value) - 1
+    pixels = [[0] * width for _ in range(height)]
+    for y in range(height):
+        row = bytearray(data[y * rowsize : (y + 1) * rowsize])
+        if swap_bytes and element_size > 1:
+            for i in range(0, rowsize, element_size):
+                row[i : i + element_size] = bytes(reversed(row[i : i + element_size]))
+        for x in range(width):
+            if bits_per_pixel < 8:
+                per_byte = 8 // bits_per_pixel
+                i = x % per_byte
+                if reverse_pixels:
+                    i = per_byte - 1 - i
+                value = row[x // per_byte] >> (i * bits_per_pixel) & ((1 << bits_per_pixel) - 1)
+            elif bits_per_pixel == 24:
+                value = row[x * 3] << 16 | row[x * 3 + 1] << 8 | row[x * 3 + 2]
+            else:
+                n = bits_per_pixel // 8
+                value = int.from_bytes(row[x * n : (x + 1) * n], "little")
+            pixels[height - 1 - y if reverse_rows else y][x] = value & mask
+    return pixels, rowsize * height
+
+
+def check(width, height, bits_per_value, bits_per_pixel, element_size, reverse_pixels, swap_bytes, reverse_rows):
+    if bits_per_pixel == 24 and element_size != 1:
+        return True
+    elements_per_row = (width * bits_per_pixel + element_size * 8 - 1) // (element_size * 8)
+    size = element_size * elements_per_row * height
+    data = bytes((i * 73 + 41) & 0xFF for i in range(size))
+    expected, _ = expected_pixels(data, width, height, bits_per_pixel, element_size, reverse_pixels, swap_bytes, reverse_rows, bits_per_value)
+    bitmap = displayio.Bitmap(width, height, 1 << bits_per_value)
+    f = io.BytesIO(data + b"trailing")
+    bitmaptools.readinto(bitmap, f, bits_per_pixel, element_size, reverse_pixels, swap_bytes, reverse_rows)
+    if f.tell() != size:
+        print("position", f.tell(), size)
+        return False
+    for y in range(height):
+        for x in range(width):
+            if bitmap[x, y] != expected[y][x]:
+                print("pixel", x, y, bitmap[x, y], expected[y][x])
+                return False
+    return True
+
+
+for bits_per_value, widths in ((1, (7, 32, 64)), (2, (5, 16, 32)), (4, (3, 8, 16)), (8, (3, 4, 12)), (16, (1, 2, 6))):
+    for bits_per_pixel in (1, 2, 4, 8, 16, 24, 32):
+        if bits_per_pixel > 8 and bits_per_value < 16:
+            continue
+        failures = 0
+        for width in widths:
+            for element_size in (1, 2, 4):
+                for flags in range(8):
+                    if not check(width, 5, bits_per_value, bits_per_pixel, element_size, bool(flags & 1), bool(flags & 2), bool(flags & 4)):
+                        print("failed", width, element_size, flags)
+                        failures += 1
+        print(bits_per_value, bits_per_pixel, "ok" if failures == 0 else "failures")
+
+# Running out of data raises EOFError.
+bitmap = displayio.Bitmap(32, 4, 2)
+try:
+    bitmaptools.readinto(bitmap, io.BytesIO(bytes(15)), 1, 4, True, True)
+except EOFError:
+    print("EOFError")
+try:
+    bitmaptools.readinto(bitmap, io.BytesIO(bytes(15)), 1, 1)
+except EOFError:
+    print("EOFError")
@@ -0,0 +1,51 @@
+import bitmaptools
+import displayio
+import math
+
+
+def dump(b):
+    for y in range(b.height):
+        print(" ".join("{:04x}".format(b[x, y]) for x in range(b.width)))
+    print()
+
+
+src = displayio.Bitmap(4, 3, 65536)
+for y in range(3):
+    for x in range(4):
+        src[x, y] = y * 4 + x
+
+# nearest neighbour: identity, quarter turn and double size
+for angle, scale in ((0, 1), (math.pi / 2, 1), (0, 2)):
+    dest = displayio.Bitmap(8, 8, 65536)
+    dest.fill(0xFFFF)
+    bitmaptools.rotozoom(dest, src, angle=angle, scale=scale, ox=4, oy=4, px=2, py=1)
+    dump(dest)
+
+# source clip and skip index
+dest = displayio.Bitmap(8, 8, 65536)
+dest.fill(0xFFFF)
+bitmaptools.rotozoom(
+    dest, src, ox=4, oy=4, px=2, py=1, source_clip0=(1, 0), source_clip1=(3, 2), skip_index=5
+)
+dump(dest)
+
+# bilinear filtering of a two colour ramp
+ramp = displayio.Bitmap(2, 1, 65536)
+ramp[0, 0] = 0x0000
+ramp[1, 0] = 0xFFFF
+for colorspace in (displayio.Colorspace.RGB565, displayio.Colorspace.RGB565_SWAPPED):
+    dest = displayio.Bitmap(8, 1, 65536)
+    bitmaptools.rotozoom(
+        dest, ramp, ox=0, oy=0, px=0, py=0, scale=4, bilinear=True, colorspace=colorspace
+    )
+    dump(dest)
+
+ramp[1, 0] = 0xF800
+dest = displayio.Bitmap(8, 1, 65536)
+bitmaptools.rotozoom(dest, ramp, ox=0, oy=0, px=0, py=0, scale=4, bilinear=True)
+dump(dest)
+
+try:
+    bitmaptools.rotozoom(displayio.Bitmap(8, 8, 256), displayio.Bitmap(4, 4, 256), bilinear=True)
+except ValueError as e:
+    print("ValueError", e)
@@ -0,0 +1,37 @@
+import displayio
+
+# A sprite-like image: long runs with a few noisy rows
+for value_count in (2, 16, 256, 65536):
+    b = displayio.Bitmap(300, 7, value_count)
+    for y in range(b.height):
+        for x in range(b.width):
+            if y == 3:
+                b[x, y] = (x * 7) % value_count
+            elif 100 <= x < 180:
+                b[x, y] = (y + 1) % value_count
+    c = displayio.CompressedBitmap(b)
+    print(c.width, c.height, c.bits_per_value, c.compressed_size)
+
+    # sequential, backwards and random access all decode identically
+    ok = True
+    for y in range(b.height):
+        for x in range(b.width):
+            ok = ok and c[x, y] == b[x, y]
+        for x in range(b.width - 1, -1, -1):
+            ok = ok and c[x, y] == b[x, y]
+    for i in range(0, b.width * b.height, 97):
+        ok = ok and c[i] == b[i]
+    print(ok)
+
+b = displayio.Bitmap(0, 0, 2)
+print(displayio.CompressedBitmap(b).compressed_size)
+
+try:
+    c[0, 0] = 1
+except TypeError:
+    print("TypeError")
+
+try:
+    c[300, 0]
+except IndexError as e:
+    print("IndexError", e)
@@ -0,0 +1,84 @@
+import os
+
+os.umount("/")
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+
+    def readblocks(self, block, buf, off=0):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        buf[:] = self.data[addr : addr + len(buf)]
+
+    def writeblocks(self, block, buf, off=None):
+        if off is None:
+            # erase, then write
+            off = 0
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        self.data[addr : addr + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # block size
+            return self.ERASE_BLOCK_SIZE
+        if op == 6:  # erase block
+            return 0
+
+
+bdev = RAMBlockDevice(256)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/")
+
+
+def write_settings(lines):
+    with open("/settings.toml", "w") as f:
+        f.write("\n".join(lines))
+
+
+# More keys than the index holds, so lookups near the end fall back to a scan.
+lines = ["# many keys"]
+for i in range(200):
+    lines.append(f'key{i} = "value{i}"')
+    if i % 50 == 0:
+        lines.append("")
+        lines.append(f"  spaced{i} = {i}  # comment")
+lines.append('dup = "first"')
+lines.append('dup = "second"')
+lines.append('with space = "spaced key"')
+lines.append("[section]")
+lines.append('hidden = "in a table"')
+write_settings(lines)
+
+for key in ("key0", "key1", "key47", "key48", "key199", "spaced0", "spaced150"):
+    print(key, repr(os.getenv(key)))
+print("dup", repr(os.getenv("dup")))
+print("with space", repr(os.getenv("with space")))
+print("hidden", repr(os.getenv("hidden")))
+print("missing", repr(os.getenv("missing", "default")))
+print("key", repr(os.getenv("key")))
+print("key1000", repr(os.getenv("key1000")))
+
+# Rewriting the file with the same length must not return stale values.
+write_settings([f'key{i} = "VALUE{i}"' for i in range(200)])
+print("key0", repr(os.getenv("key0")))
+print("key199", repr(os.getenv("key199")))
+print("dup", repr(os.getenv("dup")))
+
+# Lines move when an earlier one grows.
+write_settings(['key0 = "' + "x" * 100 + '"'] + [f"key{i} = {i}" for i in range(1, 200)])
+print("key0", len(os.getenv("key0")))
+print("key1", repr(os.getenv("key1")))
+print("key150", repr(os.getenv("key150")))
+
+# A fresh filesystem with identical contents is indexed again.
+os.umount("/")
+bdev = RAMBlockDevice(256)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/")
+print("key1", repr(os.getenv("key1")))
+write_settings(['key1 = "new filesystem"'])
+print("key1", repr(os.getenv("key1")))
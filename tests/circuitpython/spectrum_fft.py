@@ -0,0 +1,71 @@
+import array
+import audiocore
+import math
+import spectrum
+
+
+def tone(n, amplitude, cycles, typecode="h"):
+    return array.array(
+        typecode, [int(amplitude * math.cos(2 * math.pi * cycles * i / n)) for i in range(n)]
+    )
+
+
+def peaks(out, threshold=50):
+    return [(k, v) for k, v in enumerate(out) if v > threshold]
+
+
+fft = spectrum.FFT(64, window=spectrum.Window.RECTANGULAR)
+print(fft.size, fft.window)
+out = array.array("H", [0] * 32)
+
+# Full scale and quiet tones keep their amplitude.
+fft.magnitude(tone(64, 32767, 5), out)
+print(peaks(out))
+fft.magnitude(tone(64, 100, 7), out)
+print(peaks(out, 2))
+
+# A Hann window halves a tone's amplitude and spreads it to the neighbouring bins.
+fft = spectrum.FFT(256)
+print(fft.window)
+out = array.array("H", [0] * 128)
+fft.magnitude(tone(256, 32767, 20), out)
+print(peaks(out))
+
+# 8 bit and unsigned input is scaled to 16 bits.
+fft.magnitude(bytearray(128 + int(127 * math.cos(2 * math.pi * 10 * i / 256)) for i in range(256)), out)
+print(peaks(out))
+
+# Audio samples are read until the transform is full.
+raw = audiocore.RawSample(tone(512, 16000, 40), sample_rate=8000)
+fft.magnitude(raw, out)
+print(peaks(out))
+
+# The float transform is unscaled and matches numpy.fft.fft.
+fft = spectrum.FFT(8)
+re = array.array("f", [1, 2, 3, 4, 0, 0, 0, 0])
+im = array.array("f", [0] * 8)
+fft.transform(re, im)
+print([round(x, 3) for x in re])
+print([round(x, 3) for x in im])
+
+for size in (3, 2, 8192):
+    try:
+        spectrum.FFT(size)
+    except ValueError as e:
+        print(e)
+
+fft = spectrum.FFT(16)
+for args in (
+    (array.array("h", [0] * 8), array.array("H", [0] * 8)),
+    (array.array("h", [0] * 16), array.array("H", [0] * 7)),
+    (array.array("h", [0] * 16), array.array("h", [0] * 8)),
+    (array.array("f", [0] * 16), array.array("H", [0] * 8)),
+):
+    try:
+        fft.magnitude(*args)
+    except ValueError as e:
+        print(e)
+try:
+    fft.transform(array.array("f", [0] * 16), array.array("f", [0] * 8))
+except ValueError as e:
+    print(e)
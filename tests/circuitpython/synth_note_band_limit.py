@@ -0,0 +1,27 @@
+import array
+import synthio
+import audiocore
+
+
+def dump_samples():
+    print([i for i in audiocore.get_buffer(s)[1][:24]])
+
+
+saw = array.array("h", [-32000 + 250 * i for i in range(256)])
+
+s = synthio.Synthesizer(sample_rate=8000, waveform=saw)
+for band_limit in (False, True):
+    for interpolate in (False, True):
+        n = synthio.Note(synthio.midi_to_hz(96), interpolate=interpolate, band_limit=band_limit)
+        print(n.band_limit, n.interpolate)
+        s.press(n)
+        dump_samples()
+        dump_samples()
+        s.release_all()
+        dump_samples()
+
+n = synthio.Note(synthio.midi_to_hz(96), waveform=saw, band_limit=True)
+s.press(n)
+dump_samples()
+n.waveform_loop_start = 64
+dump_samples()
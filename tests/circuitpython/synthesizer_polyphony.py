@@ -0,0 +1,21 @@
+import synthio
+from audiocore import get_buffer
+s = synthio.Synthesizer(sample_rate=48000, voice_count=64)
+print(s.voice_count, s.voice_stealing)
+print(synthio.Synthesizer.max_polyphony == synthio.Synthesizer().max_polyphony)
+s.press(range(20, 100))
+print(len(s.pressed))
+r, b = get_buffer(s)
+print(min(b), max(b))
+s = synthio.Synthesizer(voice_count=3, voice_stealing=True)
+s.press((60, 61, 62))
+s.press(63)
+print(s.pressed)
+s.press(61)
+s.press(64)
+print(s.pressed)
+try:
+    synthio.Synthesizer(voice_count=0)
+except ValueError as e:
+    print(e)
+s.deinit()
@@ -0,0 +1,104 @@
+import array
+import synthio
+import audiocore
+
+
+# A constant waveform makes every sample of a sounding note 16000.
+CONST = array.array("h", [16000, 16000])
+
+
+def edges(buf):
+    # The offsets at which the output changes level
+    return [i for i in range(1, len(buf)) if buf[i] != buf[i - 1]]
+
+
+s = synthio.Synthesizer(sample_rate=8000, waveform=CONST)
+print(s.sample_time)
+audiocore.get_buffer(s)
+print(s.sample_time)
+
+# Press and release in the middle of one block, to the sample.
+now = s.sample_time
+s.schedule(now + 10, press=60)
+s.schedule(now + 100, release=60)
+buf = audiocore.get_buffer(s)[1]
+print(buf[9], buf[10], buf[99], buf[100], edges(buf))
+print(s.pressed)
+
+# Events after the block are kept for later blocks.
+now = s.sample_time
+s.schedule(now + 300, press=(61, 62))
+s.schedule(now + 400, release=(61, 62))
+buf = audiocore.get_buffer(s)[1]
+print(edges(buf), s.pressed)
+buf = audiocore.get_buffer(s)[1]
+print(edges(buf), s.pressed)
+
+# Events for the same time happen in the order they were scheduled.
+n = synthio.Note(frequency=110, waveform=CONST)
+now = s.sample_time
+s.schedule(now + 5, press=n)
+s.schedule(now + 5, release=n)
+buf = audiocore.get_buffer(s)[1]
+print(edges(buf), s.pressed)
+
+# Parameter changes
+now = s.sample_time
+s.press(n)
+s.schedule_change(now + 20, n, amplitude=0.5)
+s.schedule_change(now + 40, n, amplitude=0.25, frequency=220)
+buf = audiocore.get_buffer(s)[1]
+print(buf[0], buf[20], buf[40], edges(buf), n.amplitude, n.frequency)
+lfo = synthio.LFO(rate=1)
+s.schedule_change(s.sample_time + 1, n, bend=lfo, panning=-1)
+audiocore.get_buffer(s)
+print(n.bend is lfo, n.panning)
+s.release_all()
+
+# Past times happen at the start of the next block.
+s.schedule(s.sample_time - 1000, press=60)
+buf = audiocore.get_buffer(s)[1]
+print(buf[0], s.pressed)
+s.release_all()
+
+# Cancelling
+s.schedule(s.sample_time + 1, press=70)
+s.cancel_scheduled()
+audiocore.get_buffer(s)
+print(s.pressed)
+
+# Errors leave the queue unchanged
+for args, kw in (
+    ((0,), {"press": (60, 200)}),
+    ((0,), {"press": [60, "x"]}),
+    ((0,), {"retrigger": (lfo, 3)}),
+    (("x",), {"press": 60}),
+    ((0, 60), {"amplitude": 0.5}),
+    ((0, n), {"frequency": -1}),
+):
+    try:
+        if len(args) == 2:
+            s.schedule_change(*args, **kw)
+        else:
+            s.schedule(*args, **kw)
+    except Exception as e:
+        print(type(e).__name__, e)
+s.schedule(s.sample_time + 10000, press=range(64))
+try:
+    s.schedule(s.sample_time + 10000, press=(1,))
+except RuntimeError as e:
+    print(e)
+audiocore.get_buffer(s)
+print(s.pressed)
+
+# MidiTrack keeps its note timing with whole blocks. This score plays two
+# notes, each for 20 samples with 300 samples between them.
+score = b"\0\x90\x40\x7f\x02\x80\x40\0\x1e\x90\x41\x7f\x02\x80\x41\0\x02\xff\x2f\0"
+with synthio.MidiTrack(score, sample_rate=8000, tempo=800, waveform=CONST) as m:
+    bufs = []
+    while True:
+        result, buf = audiocore.get_buffer(m)
+        bufs.append((len(buf), edges(buf)))
+        if result == 0:
+            break
+    print(bufs)
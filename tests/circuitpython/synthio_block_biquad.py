@@ -0,0 +1,53 @@
+import array, synthio
+from audiocore import render
+
+s = synthio.Synthesizer(sample_rate=8000)
+print(s.low_pass_filter(330))
+lpf = synthio.BlockBiquad(synthio.FilterMode.LOW_PASS, 400)
+print(lpf)
+print(lpf.mode, lpf.frequency, lpf.Q)
+
+
+def peak(note):
+    buf = array.array("h", [0] * 256)
+    s.press(note)
+    render(s, buf)
+    render(s, buf)
+    s.release_all()
+    render(s, buf)
+    return max(abs(v) for v in buf[:256])
+
+for f in (None, s.low_pass_filter(200), lpf, (lpf, lpf), [lpf, synthio.BlockBiquad(synthio.FilterMode.HIGH_PASS, 100, Q=2), lpf], synthio.BlockBiquad(synthio.FilterMode.NOTCH, 1000)):
+    n = synthio.Note(1000, filter=f)
+    print(peak(n))
+
+sweep = synthio.LFO(rate=4, scale=300, offset=500)
+n = synthio.Note(1000, filter=synthio.BlockBiquad(synthio.FilterMode.BAND_PASS, sweep, Q=4))
+s.blocks.append(sweep)
+print(peak(n))
+try:
+    synthio.Note(100, filter=(lpf,) * 5)
+except ValueError as e:
+    print(e)
+try:
+    synthio.Note(100, filter=(1,))
+except TypeError as e:
+    print(e)
+# A failed assignment leaves the previous filter in place
+def fresh_peak(note):
+    synth = synthio.Synthesizer(sample_rate=8000)
+    buf = array.array("h", [0] * 256)
+    synth.press(note)
+    render(synth, buf)
+    return max(abs(v) for v in buf)
+
+
+before = fresh_peak(synthio.Note(1000, filter=lpf))
+n = synthio.Note(1000, filter=lpf)
+for f in ((lpf, None), (lpf, lpf, 1), (lpf,) * 5):
+    try:
+        n.filter = f
+    except (TypeError, ValueError) as e:
+        print(e)
+    print(n.filter is lpf)
+print(fresh_peak(n) == before)
@@ -0,0 +1,84 @@
+# Check that VfsFat's sector cache returns what was written, reaches the
+# device on sync and unmount, and saves device accesses when a log is written
+# while another file is read.
+
+import os
+
+try:
+    os.VfsFat.cache_stats
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+        self.reads = 0
+        self.writes = 0
+
+    def readblocks(self, n, buf):
+        self.reads += 1
+        start = n * self.SEC_SIZE
+        buf[:] = memoryview(self.data)[start : start + len(buf)]
+
+    def writeblocks(self, n, buf):
+        self.writes += 1
+        start = n * self.SEC_SIZE
+        self.data[start : start + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+bdev = RAMBlockDevice(512)
+os.VfsFat.mkfs(bdev)
+vfs = os.VfsFat(bdev)
+os.mount(vfs, "/ramdisk")
+print(type(vfs.cache_stats()), len(vfs.cache_stats()))
+
+asset = bytes(i & 0xFF for i in range(6000))
+with open("/ramdisk/asset.bin", "wb") as f:
+    f.write(asset)
+
+# Whole sectors written by FatFs stay in the cache until the file is flushed.
+f = open("/ramdisk/pending.txt", "w")
+f.write("pending" + "." * 600)
+print("before flush", b"pending" in bdev.data)
+f.flush()
+print("after flush", b"pending" in bdev.data)
+f.close()
+
+# Append to a log a line at a time while reading an asset in small pieces.
+bdev.reads = bdev.writes = 0
+hits, misses, blocks_read, blocks_written = vfs.cache_stats()
+data = bytearray()
+with open("/ramdisk/log.txt", "w") as log, open("/ramdisk/asset.bin", "rb") as a:
+    for i in range(200):
+        log.write("line %d\n" % i)
+        data += a.read(30)
+print("asset ok", data == asset)
+stats = vfs.cache_stats()
+print("device reads", bdev.reads, "writes", bdev.writes)
+print("hits", stats[0] - hits, "misses", stats[1] - misses)
+print("blocks read", stats[2] - blocks_read, "written", stats[3] - blocks_written)
+
+with open("/ramdisk/log.txt") as f:
+    lines = f.read().split("\n")
+print(len(lines), lines[0], lines[199])
+
+# Unmounting writes everything back, so a new VfsFat on the same device sees it.
+with open("/ramdisk/last.txt", "w") as f:
+    f.write("x" * 1000)
+os.umount("/ramdisk")
+vfs2 = os.VfsFat(bdev)
+print(sorted(x[0] for x in vfs2.ilistdir("/")))
+with vfs2.open("/last.txt", "r") as f:
+    print(len(f.read()))
+with vfs2.open("/asset.bin", "rb") as f:
+    print(f.read() == asset)
@@ -0,0 +1,85 @@
+# Looking up a name that was seen before in a large FAT directory goes straight to
+# its entry, and the remembered locations stay correct as files are created,
+# renamed and removed and when the volume is remounted.
+
+import os
+
+
+class RAMBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+        self.reads = 0
+
+    def readblocks(self, n, buf):
+        self.reads += 1
+        start = n * self.SEC_SIZE
+        buf[:] = memoryview(self.data)[start : start + len(buf)]
+
+    def writeblocks(self, n, buf):
+        start = n * self.SEC_SIZE
+        self.data[start : start + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+def name(i):
+    return "/ramdisk/dir/Long File Name %03d.txt" % i
+
+
+def exists(path):
+    try:
+        os.stat(path)
+        return True
+    except OSError:
+        return False
+
+
+bdev = RAMBlockDevice(512)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/ramdisk")
+os.mkdir("/ramdisk/dir")
+
+N = 200
+for i in range(N):
+    with open(name(i), "w") as f:
+        f.write(str(i))
+
+# The last file is remembered from when it was created, so finding it again only
+# reads the sectors holding its entry, not the whole directory.
+bdev.reads = 0
+os.stat(name(N - 1))
+print("direct", bdev.reads <= 2)
+
+# Every name is found, in any case, with the right contents.
+ok = True
+for i in range(N):
+    path = name(i)
+    with open(path[:13] + path[13:].upper() if i % 2 else path) as f:
+        ok = ok and f.read() == str(i)
+print("all found", ok)
+
+# A renamed file is found under its new name only, and a removed one not at all.
+os.rename(name(10), "/ramdisk/dir/renamed.txt")
+os.remove(name(20))
+print(exists(name(10)), exists("/ramdisk/dir/renamed.txt"), exists(name(20)))
+with open("/ramdisk/dir/renamed.txt") as f:
+    print(f.read())
+
+# A new file may reuse the freed entries.
+with open("/ramdisk/dir/x.txt", "w") as f:
+    f.write("x")
+print(exists(name(10)), exists(name(20)), exists("/ramdisk/dir/x.txt"), exists(name(21)))
+
+# After a remount the remembered locations are not trusted, but lookups still work.
+os.umount("/ramdisk")
+os.mount(os.VfsFat(bdev), "/ramdisk")
+print(exists(name(N - 1)), exists(name(10)), exists("/ramdisk/dir/renamed.txt"))
+print(len(os.listdir("/ramdisk/dir")))
+
+os.umount("/ramdisk")
@@ -0,0 +1,112 @@
+# Files opened for appending with buffering=n on a FAT volume collect records in
+# RAM and commit whole records at once. At every point during a commit, the
+# volume holds a file that ends after a whole record.
+
+import os
+import time
+
+
+class RAMBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+        self.writes = 0
+        self.snapshots = None
+
+    def readblocks(self, n, buf):
+        start = n * self.SEC_SIZE
+        buf[:] = memoryview(self.data)[start : start + len(buf)]
+
+    def writeblocks(self, n, buf):
+        self.writes += 1
+        start = n * self.SEC_SIZE
+        self.data[start : start + len(buf)] = buf
+        if self.snapshots is not None:
+            self.snapshots.append(bytes(self.data))
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+def size(path):
+    return os.stat(path)[6]
+
+
+def record(i):
+    return "%04d,sensor,%d\n" % (i, i * 37 % 1000)
+
+
+bdev = RAMBlockDevice(256)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/ramdisk")
+
+f = open("/ramdisk/log.csv", "a", buffering=1024)
+print(type(f).__name__, hasattr(f, "read"))
+expected = ""
+bdev.writes = 0
+for i in range(100):
+    expected += record(i)
+    f.write(record(i))
+# Only the records that filled the buffer are in the file so far.
+print(0 < size("/ramdisk/log.csv") < len(expected), f.tell() == len(expected))
+# Far fewer device writes than records.
+print("few writes", bdev.writes < 10)
+f.flush()
+print(size("/ramdisk/log.csv") == len(expected))
+
+# A record larger than the buffer is written on its own.
+big = "x" * 2000 + "\n"
+f.write(big)
+expected += big
+print(size("/ramdisk/log.csv") == len(expected))
+
+try:
+    f.seek(0)
+except OSError as er:
+    print("seek", er.errno)
+
+# Records are committed on the first write after the commit interval.
+f.write(record(100))
+expected += record(100)
+time.sleep_ms(1100)
+f.write(record(101))
+print(size("/ramdisk/log.csv") == len(expected))
+expected += record(101)
+f.close()
+
+with open("/ramdisk/log.csv") as f:
+    print(f.read() == expected)
+
+# Without buffering, or with other modes, files are as before.
+with open("/ramdisk/plain.txt", "a") as f:
+    print(type(f).__name__, hasattr(f, "read"))
+with open("/ramdisk/plain.txt", "a+", buffering=1024) as f:
+    print(type(f).__name__, hasattr(f, "read"))
+
+# Take a copy of the volume after every block written during one commit, and
+# check that each copy holds a file of whole records.
+with open("/ramdisk/log.csv", "a", buffering=4096) as f:
+    bdev.snapshots = []
+    for i in range(200, 400):
+        f.write(record(i))
+    f.flush()
+    bdev.snapshots, snapshots = None, bdev.snapshots
+os.umount("/ramdisk")
+
+print("snapshots", len(snapshots) > 2)
+sizes = set()
+for data in snapshots:
+    copy = RAMBlockDevice(0)
+    copy.data = bytearray(data)
+    vfs = os.VfsFat(copy)
+    with vfs.open("/log.csv", "r") as f:
+        text = f.read()
+    lines = text[len(expected) :].split("\n")
+    assert text.startswith(expected) and lines[-1] == ""
+    assert all(line == record(200 + i).strip() for i, line in enumerate(lines[:-1]))
+    sizes.add(len(text))
+print("sizes", len(sizes))
@@ -0,0 +1,75 @@
+# Large reads and writes of a file whose clusters are next to each other on the
+# block device reach it as a few multi-block transfers, not one per cluster.
+
+import os
+
+
+class RAMBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+        self.log = None
+
+    def readblocks(self, n, buf):
+        if self.log is not None and len(buf) > self.SEC_SIZE:
+            self.log.append(("read", len(buf) // self.SEC_SIZE))
+        start = n * self.SEC_SIZE
+        buf[:] = memoryview(self.data)[start : start + len(buf)]
+
+    def writeblocks(self, n, buf):
+        if self.log is not None and len(buf) > self.SEC_SIZE:
+            self.log.append(("write", len(buf) // self.SEC_SIZE))
+        start = n * self.SEC_SIZE
+        self.data[start : start + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+bdev = RAMBlockDevice(512)
+os.VfsFat.mkfs(bdev)
+vfs = os.VfsFat(bdev)
+os.mount(vfs, "/ramdisk")
+print("cluster size", vfs.statvfs("/")[0])
+
+data = bytes(i * 7 & 0xFF for i in range(40 * 512))
+
+bdev.log = []
+with open("/ramdisk/big.bin", "wb") as f:
+    f.write(data)
+print(bdev.log)
+
+bdev.log = []
+buf = bytearray(len(data))
+with open("/ramdisk/big.bin", "rb") as f:
+    f.readinto(buf)
+print(buf == data)
+print(bdev.log)
+
+# Unaligned, so the first and last partial sectors go through the sector window.
+bdev.log = []
+with open("/ramdisk/big.bin", "rb") as f:
+    f.seek(100)
+    print(f.read(30 * 512) == data[100 : 100 + 30 * 512])
+print(bdev.log)
+
+# A file that is split in two on the device is read in two pieces.
+with open("/ramdisk/a.bin", "wb") as f:
+    f.write(data[: 8 * 512])
+with open("/ramdisk/b.bin", "wb") as f:
+    f.write(data[: 8 * 512])
+with open("/ramdisk/a.bin", "ab") as f:
+    f.write(data[: 8 * 512])
+bdev.log = []
+buf = bytearray(16 * 512)
+with open("/ramdisk/a.bin", "rb") as f:
+    f.readinto(buf)
+print(buf == data[: 8 * 512] * 2)
+print(bdev.log)
+bdev.log = None
+
+os.umount("/ramdisk")
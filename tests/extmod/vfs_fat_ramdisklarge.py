@@ -22,10 +22,13 @@ class RAMBDevSparse:
 
     def readblocks(self, n, buf):
         # print("readblocks(%s, %x(%d))" % (n, id(buf), len(buf)))
-        assert len(buf) == self.SEC_SIZE
-        if n not in self.data:
-            self.data[n] = bytearray(self.SEC_SIZE)
-        buf[:] = self.data[n]
+        assert len(buf) % self.SEC_SIZE == 0
+        mv = memoryview(buf)
+        for off in range(0, len(buf), self.SEC_SIZE):
+            s = n + off // self.SEC_SIZE
+            if s not in self.data:
+                self.data[s] = bytearray(self.SEC_SIZE)
+            mv[off : off + self.SEC_SIZE] = self.data[s]
 
     def writeblocks(self, n, buf):
         # print("writeblocks(%s, %x)" % (n, id(buf)))
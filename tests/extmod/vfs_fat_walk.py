@@ -0,0 +1,72 @@
+# Test os.walk() over a VfsFat filesystem using a RAM device.
+
+try:
+    import os
+
+    os.VfsFat
+    os.walk
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+
+    def readblocks(self, block, buf, off=0):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        for i in range(len(buf)):
+            buf[i] = self.data[addr + i]
+
+    def writeblocks(self, block, buf, off=0):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        for i in range(len(buf)):
+            self.data[addr + i] = buf[i]
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # block size
+            return self.ERASE_BLOCK_SIZE
+        if op == 6:  # erase block
+            return 0
+
+
+bdev = RAMBlockDevice(64)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/ramdisk")
+
+for d in ("a", "a/b", "a/b/c", "a/d", "e"):
+    os.mkdir("/ramdisk/" + d)
+for f, size in (("top.txt", 1), ("a/x", 10), ("a/b/y", 20), ("a/b/c/z", 30), ("e/w", 0)):
+    with open("/ramdisk/" + f, "w") as fp:
+        fp.write("-" * size)
+
+
+def show(top):
+    for dirpath, dirnames, filenames in os.walk(top):
+        print(dirpath, sorted(dirnames), sorted(filenames))
+
+
+# Parents come before their children.
+show("/ramdisk")
+show("/ramdisk/a/")
+
+# Pruning dirnames stops the walk descending into them.
+for dirpath, dirnames, filenames in os.walk("/ramdisk"):
+    print(dirpath)
+    if "b" in dirnames:
+        dirnames.remove("b")
+
+# Directories that can't be listed are skipped.
+print(list(os.walk("/ramdisk/missing")))
+print(list(os.walk("/ramdisk/top.txt")))
+
+# ilistdir() has each entry's type and size without a stat().
+for name, typ, inode, size in sorted(os.ilistdir("/ramdisk/a/b")):
+    print(name, typ == 0x4000, size)
+
+os.umount("/ramdisk")
@@ -0,0 +1,111 @@
+# Test VfsLfs1/VfsLfs2 cachesize and readahead options using a RAM device
+
+try:
+    import os
+
+    os.VfsLfs1
+    os.VfsLfs2
+    os.VfsLfs2.cache_stats
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 1024
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+        self.reads = 0
+
+    def readblocks(self, block, buf, off):
+        self.reads += 1
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        buf[:] = memoryview(self.data)[addr : addr + len(buf)]
+
+    def writeblocks(self, block, buf, off):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        self.data[addr : addr + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # block size
+            return self.ERASE_BLOCK_SIZE
+        if op == 6:  # erase block
+            return 0
+
+
+def read_in_pieces(vfs, path, n):
+    data = bytearray()
+    with vfs.open(path, "rb") as f:
+        while True:
+            b = f.read(n)
+            if not b:
+                return data
+            data += b
+
+
+def test(bdev, vfs_class, **kw):
+    print("test", vfs_class, sorted(kw.items()))
+    vfs_class.mkfs(bdev, **kw)
+    vfs = vfs_class(bdev, **kw)
+    stats = vfs.cache_stats()
+    print(stats if stats is None else len(stats))
+
+    asset = bytes(i * 7 & 0xFF for i in range(5000))
+    with vfs.open("asset.bin", "wb") as f:
+        f.write(asset)
+
+    bdev.reads = 0
+    print(read_in_pieces(vfs, "asset.bin", 37) == asset, bdev.reads)
+
+    # Interleave writing one file with reading and rewriting another.
+    expect = bytearray(asset)
+    with vfs.open("log.txt", "w") as log, vfs.open("asset.bin", "r+b") as a:
+        for i in range(50):
+            log.write("line %d\n" % i)
+            a.seek(i * 97)
+            a.read(20)
+            a.seek(i * 97 + 10)
+            a.write(b"%04d" % i)
+            expect[i * 97 + 10 : i * 97 + 14] = b"%04d" % i
+    print(read_in_pieces(vfs, "asset.bin", 61) == expect)
+    with vfs.open("log.txt", "r") as f:
+        lines = f.read().split("\n")
+    print(len(lines), lines[49])
+
+    # New directory entries are appended to metadata blocks that have already been read.
+    ok = True
+    for i in range(20):
+        with vfs.open("f%d" % i, "w") as f:
+            f.write("x" * i)
+        ok = ok and len(list(vfs.ilistdir())) == i + 3 and vfs.stat("f%d" % i)[6] == i
+    print(ok)
+
+    # A new mount of the same device sees everything.
+    vfs = vfs_class(bdev)
+    print(read_in_pieces(vfs, "asset.bin", 500) == expect)
+
+
+bdev = RAMBlockDevice(50)
+test(bdev, os.VfsLfs1)
+test(bdev, os.VfsLfs1, readahead=256)
+test(bdev, os.VfsLfs2)
+test(bdev, os.VfsLfs2, cachesize=256)
+test(bdev, os.VfsLfs2, readahead=256)
+test(bdev, os.VfsLfs2, cachesize=512, readahead=1024)
+
+# cachesize must be a multiple of readsize and progsize, and divide the block size.
+for cachesize in (48, 96, 384):
+    try:
+        os.VfsLfs2(bdev, cachesize=cachesize)
+    except ValueError as er:
+        print(cachesize, "ValueError")
+
+# readahead must be a multiple of readsize no larger than the block size.
+for readahead in (-1, 48, 2048, 1 << 30):
+    try:
+        os.VfsLfs2(bdev, readahead=readahead)
+    except ValueError as er:
+        print(readahead, "ValueError")
@@ -0,0 +1,87 @@
+# Test mapping VfsPosix files into memory with file.mmap().
+
+try:
+    import os, struct
+
+    os.VfsPosix
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+temp_file = "vfs_posix_mmap_test_file"
+try:
+    os.stat(temp_file)
+    print("SKIP")
+    raise SystemExit
+except OSError:
+    pass
+
+vfs = os.VfsPosix()
+with vfs.open(temp_file, "wb") as f:
+    if not hasattr(f, "mmap"):
+        print("SKIP")
+        raise SystemExit
+    f.write(bytes(range(256)) * 20)
+
+with vfs.open(temp_file, "rb") as f:
+    # Whole file, usable wherever a buffer is.
+    m = f.mmap()
+    print(len(m), bytes(memoryview(m)[250:260]))
+    print(struct.unpack_from("<HI", m, 4095))
+    m.close()
+
+    # A range that doesn't start on a page boundary.
+    with f.mmap(10, 5000) as m:
+        print(len(m), bytes(m))
+
+    # The range has to lie within the file.
+    for length, offset in ((0, 5121), (2, 5119), (-1, 0)):
+        try:
+            f.mmap(length, offset)
+        except ValueError:
+            print("ValueError")
+
+    # Read-only mappings can't be written to.
+    m = f.mmap()
+    try:
+        memoryview(m)[0] = 1
+    except TypeError:
+        print("TypeError")
+
+    # A closed mapping can't be used.
+    m.close()
+    m.close()
+    try:
+        len(m)
+    except ValueError:
+        print("ValueError")
+
+    # Memoryviews that outlive the mapping don't fault.
+    with f.mmap() as m:
+        mv = memoryview(m)
+    print(mv[0], mv[-1], len(mv))
+
+    # Writable mappings need a file opened for writing.
+    try:
+        f.mmap(writable=True)
+    except OSError:
+        print("OSError")
+
+# Writes through a writable mapping land in the file.
+with vfs.open(temp_file, "r+b") as f:
+    with f.mmap(4, 4092, writable=True) as m:
+        mv = memoryview(m)
+        mv[:] = b"abcd"
+        m.flush()
+    mv[0] = 0
+with vfs.open(temp_file, "rb") as f:
+    f.seek(4090)
+    print(f.read(8))
+
+# An empty file maps to an empty buffer.
+vfs.open(temp_file, "wb").close()
+with vfs.open(temp_file, "rb") as f:
+    with f.mmap() as m:
+        print(len(m), bytes(m))
+
+os.remove(temp_file)
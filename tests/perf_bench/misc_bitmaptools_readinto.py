@@ -0,0 +1,59 @@
+# Load 16-bit, 8-bit and 1-bit images into bitmaps with bitmaptools.readinto,
+# from data whose layout matches the bitmap's storage (read straight into the
+# bitmap) and from data that has to be converted a pixel at a time.
+
+try:
+    import io
+    import bitmaptools
+    import displayio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+# (bits_per_value, bits_per_pixel, element_size, reverse_pixels_in_element, swap_bytes_in_element)
+LAYOUTS = (
+    (16, 16, 2, False, False),
+    (16, 16, 2, False, True),
+    (8, 8, 1, False, False),
+    (1, 1, 4, True, True),
+    (16, 24, 1, False, False),
+    (1, 1, 1, False, False),
+)
+
+
+def load_all(images, nloop):
+    for loop in range(nloop):
+        for bitmap, data, layout in images:
+            _, bits_per_pixel, element_size, reverse, swap = layout
+            bitmaptools.readinto(bitmap, io.BytesIO(data), bits_per_pixel, element_size, reverse, swap)
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 25): (1, 32, 16),
+    (100, 100): (2, 64, 48),
+    (1000, 1000): (4, 160, 120),
+    (5000, 1000): (4, 320, 240),
+}
+
+
+def bm_setup(params):
+    nloop, width, height = params
+    images = []
+    for layout in LAYOUTS:
+        bits_per_value, bits_per_pixel, element_size, _, _ = layout
+        rowsize = element_size * ((width * bits_per_pixel + element_size * 8 - 1) // (element_size * 8))
+        data = bytes((i * 131 + 7) & 0xFF for i in range(rowsize * height))
+        images.append((displayio.Bitmap(width, height, 1 << bits_per_value), data, layout))
+
+    def run():
+        load_all(images, nloop)
+
+    # CPython has no displayio or bitmaptools to check the output against.
+    def result():
+        return nloop * width * height * len(LAYOUTS), None
+
+    return run, result
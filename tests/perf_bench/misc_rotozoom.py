@@ -0,0 +1,49 @@
+# Rotate and scale a 16-bit bitmap through a range of angles and scales
+# using bitmaptools.rotozoom, with and without bilinear filtering.
+
+try:
+    import bitmaptools
+    import displayio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+import math
+
+
+def rotozoom_all(dest, src, nloop, bilinear):
+    for loop in range(nloop):
+        for angle in (0, 0.5, 1.2, math.pi / 2, 2.8):
+            for scale in (0.5, 1.0, 1.7, 3.0):
+                bitmaptools.rotozoom(dest, src, angle=angle, scale=scale, bilinear=bilinear)
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 25): (1, 32, 32, False),
+    (100, 100): (1, 64, 64, False),
+    (1000, 1000): (2, 160, 120, True),
+    (5000, 1000): (4, 320, 240, True),
+}
+
+
+def bm_setup(params):
+    nloop, width, height, bilinear = params
+    src = displayio.Bitmap(width // 2, height // 2, 65536)
+    for y in range(src.height):
+        for x in range(src.width):
+            src[x, y] = (x * 2047 + y * 31) & 0xFFFF
+    dest = displayio.Bitmap(width, height, 65536)
+
+    def run():
+        rotozoom_all(dest, src, nloop, False)
+        if bilinear:
+            rotozoom_all(dest, src, nloop, True)
+
+    def result():
+        # CPython has no bitmaptools to check the output against.
+        return nloop * width * height, None
+
+    return run, result
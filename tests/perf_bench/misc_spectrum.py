@@ -0,0 +1,46 @@
+# Transform a full scale chirp with spectrum.FFT, once as 16 bit magnitudes and
+# once in floating point.  The normalisation is the number of points
+# transformed, so time_us / norm is the cost of one point.
+
+try:
+    import spectrum
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+import array
+import math
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 25): (256, 2),
+    (100, 100): (512, 4),
+    (1000, 1000): (1024, 8),
+    (5000, 1000): (4096, 8),
+}
+
+
+def bm_setup(params):
+    size, nloops = params
+    fft = spectrum.FFT(size)
+    samples = array.array(
+        "h", [int(32000 * math.sin(math.pi * i * i / (2 * size))) for i in range(size)]
+    )
+    out = array.array("H", [0] * (size // 2))
+    signal = array.array("f", samples)
+    zeros = array.array("f", [0] * size)
+    real = array.array("f", signal)
+    imag = array.array("f", zeros)
+
+    def run():
+        for _ in range(nloops):
+            fft.magnitude(samples, out)
+            real[:] = signal
+            imag[:] = zeros
+            fft.transform(real, imag)
+
+    # CPython has no spectrum to check the output against.
+    return run, lambda: (2 * nloops * size, None)
@@ -0,0 +1,58 @@
+# Render a chord from synthio.Synthesizer offline at 48kHz, without and with
+# interpolation and band limiting.  The normalisation is voices * samples, so
+# the number of voices one CPU can sustain in real time is
+# 1e6 * norm / (48000 * time_us).
+
+try:
+    import synthio
+    from audiocore import render
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+import array
+import math
+
+
+def render_blocks(synth, buf, nblocks):
+    for _ in range(nblocks):
+        render(synth, buf)
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 25): (2, 4, False),
+    (100, 100): (4, 8, False),
+    (1000, 1000): (8, 40, True),
+    (5000, 1000): (64, 20, True),
+}
+
+
+def bm_setup(params):
+    nvoices, nblocks, band_limit = params
+    saw = array.array("h", [int(32000 * (2 * i / 256 - 1)) for i in range(256)])
+    sine = array.array("h", [int(32000 * math.sin(2 * math.pi * i / 256)) for i in range(256)])
+    synth = synthio.Synthesizer(sample_rate=48000, waveform=saw, voice_count=nvoices)
+    notes = []
+    for i in range(nvoices):
+        notes.append(
+            synthio.Note(
+                synthio.midi_to_hz(24 + i % 80),
+                waveform=sine if i % 3 == 2 else None,
+                interpolate=i % 2 == 1,
+                band_limit=band_limit,
+            )
+        )
+    synth.press(notes)
+    buf = array.array("h", [0] * 256)
+    # Let the attack finish so every voice is rendered on every block.
+    render_blocks(synth, buf, 4)
+    samples = len(buf)
+
+    def run():
+        render_blocks(synth, buf, nblocks)
+
+    # CPython has no synthio to check the output against.
+    return run, lambda: (nvoices * nblocks * samples, None)
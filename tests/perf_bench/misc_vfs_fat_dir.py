@@ -0,0 +1,72 @@
+# Repeatedly stat and open a handful of files spread through one directory of a
+# FAT filesystem on a RAM block device.  Without remembering where names were
+# found, each lookup reads the directory from the top, so the time grows with
+# the number of entries; with it, the time should stay about the same from a
+# directory of 10 entries to one of 5000.
+
+try:
+    import os
+
+    os.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        start = n * self.SEC_SIZE
+        buf[:] = memoryview(self.data)[start : start + len(buf)]
+
+    def writeblocks(self, n, buf):
+        start = n * self.SEC_SIZE
+        self.data[start : start + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+def lookup(paths, nloops):
+    for _ in range(nloops):
+        for p in paths:
+            os.stat(p)
+            with open(p, "rb") as f:
+                f.read()
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 25): (10, 20),
+    (100, 100): (100, 40),
+    (1000, 1000): (1000, 100),
+    (5000, 4000): (5000, 100),
+}
+
+
+def bm_setup(params):
+    nfiles, nloops = params
+    # Each name takes an LFN entry and an SFN entry, 64 bytes of directory.
+    bdev = RAMBlockDevice(128 + nfiles // 4)
+    os.VfsFat.mkfs(bdev)
+    os.mount(os.VfsFat(bdev), "/ramdisk")
+    os.mkdir("/ramdisk/dir")
+    for i in range(nfiles):
+        open("/ramdisk/dir/Log %04d.txt" % i, "w").close()
+    paths = ["/ramdisk/dir/Log %04d.txt" % i for i in range(nfiles - 1, -1, -max(1, nfiles // 8))]
+
+    def run():
+        lookup(paths, nloops)
+        os.umount("/ramdisk")
+
+    # CPython has no os.VfsFat to check the output against.
+    return run, lambda: (len(paths) * nloops, None)
@@ -0,0 +1,76 @@
+# Read a file from a littlefs2 filesystem on a RAM block device in small and
+# large pieces.  littlefs on its own calls the block device for every
+# cache_size bytes, 128 by default; with a read-ahead cache each call fetches
+# 4 kB, which should bring the throughput much closer to that of the device.
+
+try:
+    import os
+
+    os.VfsLfs2
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    ERASE_BLOCK_SIZE = 4096
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.ERASE_BLOCK_SIZE)
+
+    def readblocks(self, block, buf, off):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        buf[:] = memoryview(self.data)[addr : addr + len(buf)]
+
+    def writeblocks(self, block, buf, off):
+        addr = block * self.ERASE_BLOCK_SIZE + off
+        self.data[addr : addr + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return len(self.data) // self.ERASE_BLOCK_SIZE
+        if op == 5:  # block size
+            return self.ERASE_BLOCK_SIZE
+        if op == 6:  # erase block
+            return 0
+
+
+def read_file(vfs, nloops):
+    total = 0
+    for size in (64, 512, 4096):
+        buf = bytearray(size)
+        for _ in range(nloops):
+            with vfs.open("asset.bin", "rb") as f:
+                while True:
+                    n = f.readinto(buf)
+                    if not n:
+                        break
+                    total += n
+    return total
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 25): (2048, 1),
+    (100, 100): (8192, 2),
+    (1000, 1000): (32768, 4),
+    (5000, 1000): (65536, 8),
+}
+
+
+def bm_setup(params):
+    nbytes, nloops = params
+    bdev = RAMBlockDevice(8 + nbytes // 2048)
+    os.VfsLfs2.mkfs(bdev)
+    kw = {"readahead": 4096} if hasattr(os.VfsLfs2, "cache_stats") else {}
+    vfs = os.VfsLfs2(bdev, **kw)
+    with vfs.open("asset.bin", "wb") as f:
+        f.write(bytes(range(256)) * (nbytes // 256))
+    result = [0]
+
+    def run():
+        result[0] = read_file(vfs, nloops)
+
+    return run, lambda: (3 * nloops * nbytes, result[0])
@@ -46,6 +46,88 @@ stream.set_error(errno.EAGAIN)
 buf = io.BufferedWriter(stream, 8)
 print(buf.write(bytearray(16)))
 
+# test OnDiskBitmap's row cache against uncached reads
+import os
+import struct
+
+
+class RAMBlockDevice:
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * 512)
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * 512 : n * 512 + len(buf)]
+
+    def writeblocks(self, n, buf):
+        self.data[n * 512 : n * 512 + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # block count
+            return len(self.data) // 512
+        if op == 5:  # block size
+            return 512
+
+
+def bmp(width, height, bpp, header_size, palette, pixel):
+    stride = (width * bpp + 31) // 32 * 4
+    offset = 14 + header_size + len(palette) * 4
+    rows = bytearray(stride * height)
+    for y in range(height):
+        row = (height - 1 - y) * stride
+        for x in range(width):
+            if bpp == 24:
+                rows[row + x * 3 : row + x * 3 + 3] = struct.pack("<I", pixel(x, y))[:3]
+            else:
+                rows[row + x // 2] |= pixel(x, y) << (4 - x % 2 * 4)
+    header = struct.pack("<2sIII", b"BM", offset + len(rows), 0, offset)
+    info = struct.pack("<IiiHHIIiiII", header_size, width, height, 1, bpp, 0, len(rows), 0, 0, len(palette), 0)
+    info += bytes(header_size - len(info))
+    return header + info + b"".join(struct.pack("<I", c) for c in palette) + rows
+
+
+bdev = RAMBlockDevice(64)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/odb")
+for name, image in (
+    ("24", bmp(5, 7, 24, 124, [], lambda x, y: x * 0x010203 + y * 0x302010)),
+    ("4", bmp(9, 6, 4, 40, [i * 0x111111 for i in range(16)], lambda x, y: (x * 3 + y * 5) % 16)),
+):
+    with open("/odb/" + name + ".bmp", "wb") as f:
+        f.write(image)
+    with open("/odb/" + name + ".bmp", "rb") as f:
+        data[4](f)
+os.umount("/odb")
+
+# test that a block device raising during a log file's timed commit doesn't
+# escape from the background task, and that the records are kept
+import time
+
+
+class FailingBlockDevice(RAMBlockDevice):
+    fail = False
+
+    def writeblocks(self, n, buf):
+        if self.fail:
+            raise ValueError("fail")
+        super().writeblocks(n, buf)
+
+
+bdev = FailingBlockDevice(64)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/log")
+f = open("/log/log.txt", "a", buffering=512)
+f.write("one\n")
+bdev.fail = True
+time.sleep_ms(1100)
+print("log busy", data[5]())
+print("log size", os.stat("/log/log.txt")[6])
+bdev.fail = False
+f.write("two\n")
+f.close()
+with open("/log/log.txt") as f:
+    print(repr(f.read()))
+os.umount("/log")
+
 # function defined in C++ code
 print("cpp", extra_cpp_coverage())
 